@@ -0,0 +1,75 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+namespace VideoKit.Tests {
+
+    using System;
+    using System.IO;
+    using System.Linq;
+    using UnityEngine;
+
+    internal sealed class AudioAnalysisSidecarTest : MonoBehaviour {
+
+        private void Start() {
+            // Create one second of a 1kHz sine, in 20ms buffers
+            const int SampleRate = 16_000;
+            var audioBuffers = Enumerable.Range(0, 50).Select(i => new AudioBuffer(
+                SampleRate,
+                1,
+                Enumerable.Range(i * 320, 320).Select(j => 0.5f * Mathf.Sin(2f * Mathf.PI * 1_000f * j / SampleRate)).ToArray(),
+                i * 20_000_000L
+            )).ToArray();
+            try {
+                TestWaveform(audioBuffers);
+                TestSpectrogram(audioBuffers);
+                Debug.Log(@"Audio analysis sidecar test completed");
+            } finally {
+                foreach (var audioBuffer in audioBuffers)
+                    audioBuffer.Dispose();
+            }
+        }
+
+        private static void TestWaveform(AudioBuffer[] audioBuffers) {
+            // Compute
+            var waveform = AudioWaveform.Compute(audioBuffers, 10, 16_000L);
+            Debug.Assert(waveform.min.All(value => Mathf.Abs(value + 0.5f) < 1e-3f), $"Waveform minimum is {string.Join(@", ", waveform.min)}");
+            Debug.Assert(waveform.max.All(value => Mathf.Abs(value - 0.5f) < 1e-3f), $"Waveform maximum is {string.Join(@", ", waveform.max)}");
+            Debug.Assert(waveform.rms.All(value => Mathf.Abs(value - 0.5f / Mathf.Sqrt(2f)) < 1e-3f), $"Waveform RMS is {string.Join(@", ", waveform.rms)}");
+            // Round trip
+            var data = Write(waveform.Write);
+            var result = AudioWaveform.Read(new MemoryStream(data), waveform.bucketCount)!;
+            Debug.Assert(result != null, @"Failed to read waveform sidecar");
+            Debug.Assert(result!.duration == waveform.duration, $"Waveform duration is {result.duration} but expected {waveform.duration}");
+            Debug.Assert(result.min.SequenceEqual(waveform.min) && result.max.SequenceEqual(waveform.max) && result.rms.SequenceEqual(waveform.rms), @"Waveform sidecar does not match");
+            // Sidecars with other settings or truncated data must be recomputed
+            Debug.Assert(AudioWaveform.Read(new MemoryStream(data), 20) == null, @"Read waveform sidecar with a different bucket count");
+            Debug.Assert(AudioWaveform.Read(new MemoryStream(data, 0, data.Length - 4), 10) == null, @"Read truncated waveform sidecar");
+        }
+
+        private static void TestSpectrogram(AudioBuffer[] audioBuffers) {
+            // Compute
+            var spectrogram = AudioSpectrogram.Compute(audioBuffers, 512, 256);
+            var peak = Enumerable.Range(0, spectrogram.binCount).OrderByDescending(bin => spectrogram[spectrogram.frameCount / 2, bin]).First();
+            Debug.Assert(spectrogram.frameCount == (16_000 - 512) / 256 + 1, $"Spectrogram has {spectrogram.frameCount} frames");
+            Debug.Assert(Mathf.Abs(spectrogram.GetFrequency(peak) - 1_000f) < 1f, $"Spectrogram peaks at {spectrogram.GetFrequency(peak)}Hz");
+            // Round trip
+            var data = Write(spectrogram.Write);
+            var result = AudioSpectrogram.Read(new MemoryStream(data), 512, 256);
+            Debug.Assert(result != null, @"Failed to read spectrogram sidecar");
+            Debug.Assert(result!.sampleRate == spectrogram.sampleRate, $"Spectrogram sample rate is {result.sampleRate} but expected {spectrogram.sampleRate}");
+            Debug.Assert(result.data.SequenceEqual(spectrogram.data), @"Spectrogram sidecar does not match");
+            // Sidecars with other settings or truncated data must be recomputed
+            Debug.Assert(AudioSpectrogram.Read(new MemoryStream(data), 1024, 256) == null, @"Read spectrogram sidecar with a different FFT size");
+            Debug.Assert(AudioSpectrogram.Read(new MemoryStream(data), 512, 128) == null, @"Read spectrogram sidecar with a different hop size");
+            Debug.Assert(AudioSpectrogram.Read(new MemoryStream(data, 0, data.Length - 4), 512, 256) == null, @"Read truncated spectrogram sidecar");
+        }
+
+        private static byte[] Write(Action<Stream> write) {
+            using var stream = new MemoryStream();
+            write(stream);
+            return stream.ToArray();
+        }
+    }
+}
\ No newline at end of file
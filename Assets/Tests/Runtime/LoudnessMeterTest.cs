@@ -0,0 +1,42 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+namespace VideoKit.Tests {
+
+    using System;
+    using UnityEngine;
+
+    internal sealed class LoudnessMeterTest : MonoBehaviour {
+
+        private void Start() {
+            // EBU Tech 3341 test cases 1 and 2: stereo 1kHz sine for 20s, measures the same loudness as its level in dBFS
+            foreach (var level in new[] { -23f, -33f }) {
+                var meter = new LoudnessMeter(48_000, 2);
+                var data = CreateSine(48_000, 2, 1_000f, level, 20f);
+                for (var offset = 0; offset < data.Length; offset += 960 * 2) // append in 20ms buffers, like a microphone
+                    meter.Append(data.AsSpan(offset, Math.Min(960 * 2, data.Length - offset)));
+                Debug.Assert(Mathf.Abs(meter.integratedLoudness - level) <= 0.1f, $"Integrated loudness is {meter.integratedLoudness} LUFS but expected {level} LUFS");
+                Debug.Assert(Mathf.Abs(meter.momentaryLoudness - level) <= 0.1f, $"Momentary loudness is {meter.momentaryLoudness} LUFS but expected {level} LUFS");
+                Debug.Assert(Mathf.Abs(meter.shortTermLoudness - level) <= 0.1f, $"Short-term loudness is {meter.shortTermLoudness} LUFS but expected {level} LUFS");
+                Debug.Assert(Mathf.Abs(meter.samplePeak - level) <= 0.1f, $"Sample peak is {meter.samplePeak} dBFS but expected {level} dBFS");
+                Debug.Assert(Mathf.Abs(meter.duration - 20f) < 1e-3f, $"Measured duration is {meter.duration}s");
+                // Reset
+                meter.Reset();
+                Debug.Assert(float.IsNegativeInfinity(meter.integratedLoudness), $"Integrated loudness is {meter.integratedLoudness} LUFS after reset");
+            }
+            Debug.Log(@"Loudness meter test completed");
+        }
+
+        private static float[] CreateSine(int sampleRate, int channelCount, float frequency, float level, float duration) {
+            var amplitude = Mathf.Pow(10f, level / 20f);
+            var frames = (int)(sampleRate * duration);
+            var data = new float[frames * channelCount];
+            for (var i = 0; i < frames; ++i)
+                for (var c = 0; c < channelCount; ++c)
+                    data[i * channelCount + c] = amplitude * Mathf.Sin(2f * Mathf.PI * frequency * i / sampleRate);
+            return data;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+namespace VideoKit.Tests {
+
+    using System;
+    using System.IO;
+    using System.Linq;
+    using UnityEngine;
+    using Internal;
+    using static MP4TestUtility;
+
+    internal sealed class MP4ConcatenateSegmentsTest : MonoBehaviour {
+
+        private void Start() {
+            var directory = CreateDirectory();
+            try {
+                // Write segments, where only the first segment has audio
+                var paths = new[] { @"segment0.mp4", @"segment1.mp4", @"segment2.mp4" }.Select(name => Path.Combine(directory, name)).ToArray();
+                MP4Container.Write(CreateMovie(CreateTrack(directory, @"vide", 1, 30, 30), CreateTrack(directory, @"soun", 2, 150, 1)), paths[0]);
+                MP4Container.Write(CreateMovie(CreateTrack(directory, @"vide", 3, 45, 15)), paths[1]);
+                MP4Container.Write(CreateMovie(CreateTrack(directory, @"vide", 4, 15, 15)), paths[2]);
+                var segments = paths.Select(MP4Container.Read).ToArray();
+                // Concatenate, with gaps between segments
+                var path = Path.Combine(directory, @"concatenate.mp4");
+                MP4Container.Write(MP4Container.Concatenate(segments, new[] { 0.0, 1.0, 3.5 }), path);
+                var movie = MP4Container.Read(path);
+                var video = movie.GetTrack(@"vide")!;
+                var audio = movie.GetTrack(@"soun")!;
+                Debug.Assert(movie.tracks.Count == 2, $"Concatenated movie has {movie.tracks.Count} tracks");
+                Debug.Assert(video.samples.Count == 90, $"Concatenated video has {video.samples.Count} samples");
+                Debug.Assert(audio.samples.Count == 150, $"Concatenated audio has {audio.samples.Count} samples");
+                var duration = 3.5 + 14 * FrameDuration / 1e+9;
+                Debug.Assert(Math.Abs(video.duration / (double)video.timescale - duration) < 0.01, $"Concatenated video has duration {video.duration / (double)video.timescale}");
+                var data = segments.SelectMany((segment, i) => ReadSamples(paths[i], segment.GetTrack(@"vide")!)).ToArray();
+                Debug.Assert(ReadSamples(path, video).SequenceEqual(data), @"Concatenated video samples do not match");
+                Debug.Assert(new[] { 0, 30, 75 }.All(i => video.samples[i].sync), @"Concatenated video does not start segments with keyframes");
+                Debug.Log(@"Concatenate segments test completed");
+            } finally {
+                Directory.Delete(directory, true);
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+namespace VideoKit.Tests {
+
+    using System;
+    using System.Buffers.Binary;
+    using System.IO;
+    using System.Linq;
+    using UnityEngine;
+    using Internal;
+    using static MP4TestUtility;
+
+    internal sealed class MP4DisplayTransformTest : MonoBehaviour {
+
+        private void Start() {
+            var directory = CreateDirectory();
+            try {
+                // Write video with identity matrix
+                var path = Path.Combine(directory, @"transform.mp4");
+                var movie = CreateMovie(CreateTrack(directory, @"vide", 1, 10, 1));
+                var header = movie.tracks[0].header;
+                BinaryPrimitives.WriteInt32BigEndian(header.AsSpan(76), 1280 << 16);
+                BinaryPrimitives.WriteInt32BigEndian(header.AsSpan(80), 720 << 16);
+                MP4Container.Write(movie, path);
+                // Rotate
+                MP4Container.SetDisplayTransform(path, PixelBuffer.Rotation._90, false);
+                var matrix = ReadMatrix(path);
+                var expected = new[] { 0, 1 << 16, 0, -(1 << 16), 0, 0, 720 << 16, 0, 1 << 30 };
+                Debug.Assert(matrix.SequenceEqual(expected), $"Display matrix does not match: {string.Join(@", ", matrix)}");
+                // Mirror
+                MP4Container.SetDisplayTransform(path, PixelBuffer.Rotation._0, true);
+                matrix = ReadMatrix(path);
+                expected = new[] { -(1 << 16), 0, 0, 0, 1 << 16, 0, 1280 << 16, 0, 1 << 30 };
+                Debug.Assert(matrix.SequenceEqual(expected), $"Mirrored display matrix does not match: {string.Join(@", ", matrix)}");
+                Debug.Assert(ReadSamples(path, MP4Container.Read(path).tracks[0]).SequenceEqual(ReadSamples(path, movie.tracks[0])), @"Display transform modified sample data");
+                Debug.Log(@"Display transform test completed");
+            } finally {
+                Directory.Delete(directory, true);
+            }
+        }
+
+        private static int[] ReadMatrix(string path) {
+            var header = MP4Container.Read(path).GetTrack(@"vide")!.header;
+            var offset = header[0] == 1 ? 52 : 40;
+            return Enumerable.Range(0, 9).Select(i => BinaryPrimitives.ReadInt32BigEndian(header.AsSpan(offset + 4 * i))).ToArray();
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+namespace VideoKit.Tests {
+
+    using System;
+    using System.Buffers.Binary;
+    using System.IO;
+    using System.Linq;
+    using System.Text;
+    using UnityEngine;
+    using Internal;
+    using static MP4TestUtility;
+
+    internal sealed class MP4InlineParameterSetsTest : MonoBehaviour {
+
+        private void Start() {
+            var directory = CreateDirectory();
+            try {
+                // Splice two segments with different parameter sets, like `MediaAsset.FromConcatenatingAssets` with transitions
+                var path = Path.Combine(directory, @"parameters.mp4");
+                var track = CreateTrack(directory, @"vide", 1, 4, 2);
+                track.sampleDescriptions.Clear();
+                track.sampleDescriptions.Add(CreateAVCSampleEntry(1, 2));
+                track.sampleDescriptions.Add(CreateAVCSampleEntry(3, 4));
+                for (var i = 0; i < track.samples.Count; ++i) {
+                    var sample = track.samples[i];
+                    sample.description = i / 2;
+                    track.samples[i] = sample;
+                }
+                var data = track.samples.Select(sample => ReadSample(sample.path!, sample)).ToArray();
+                // Inline
+                Debug.Assert(MP4Container.InlineParameterSets(track), @"Parameter sets were not inlined");
+                MP4Container.Write(CreateMovie(track), path);
+                var result = MP4Container.Read(path).tracks[0];
+                Debug.Assert(result.sampleDescriptions.Count == 1, $"Track has {result.sampleDescriptions.Count} sample descriptions");
+                Debug.Assert(Encoding.ASCII.GetString(result.sampleDescriptions[0], 4, 4) == @"avc3", @"Sample description is not an avc3 entry");
+                var samples = result.samples.Select(sample => ReadSample(path, sample)).ToArray();
+                var parameterSets = new[] {
+                    new byte[] { 0, 0, 0, 3, 0x67, 1, 1, 0, 0, 0, 2, 0x68, 2 },
+                    new byte[] { 0, 0, 0, 3, 0x67, 3, 3, 0, 0, 0, 2, 0x68, 4 },
+                };
+                for (var i = 0; i < samples.Length; ++i) {
+                    var expected = i % 2 == 0 ? parameterSets[i / 2].Concat(data[i]) : data[i];
+                    Debug.Assert(samples[i].SequenceEqual(expected), $"Sample {i} does not match");
+                }
+                Debug.Log(@"Inline parameter sets test completed");
+            } finally {
+                Directory.Delete(directory, true);
+            }
+        }
+
+        private static byte[] CreateAVCSampleEntry(byte sps, byte pps) {
+            var avcC = new byte[] { 1, 0x64, 0, 0x1F, 0xFF, 0xE1, 0, 3, 0x67, sps, sps, 1, 0, 2, 0x68, pps };
+            var entry = new byte[8 + 78 + 8 + avcC.Length];
+            BinaryPrimitives.WriteUInt32BigEndian(entry, (uint)entry.Length);
+            Encoding.ASCII.GetBytes(@"avc1").CopyTo(entry, 4);
+            BinaryPrimitives.WriteUInt32BigEndian(entry.AsSpan(86), (uint)(8 + avcC.Length));
+            Encoding.ASCII.GetBytes(@"avcC").CopyTo(entry, 90);
+            avcC.CopyTo(entry, 94);
+            return entry;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,47 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+namespace VideoKit.Tests {
+
+    using System.IO;
+    using System.Linq;
+    using UnityEngine;
+    using Internal;
+    using static MP4TestUtility;
+
+    internal sealed class MP4KeyframeTrackTest : MonoBehaviour {
+
+        private void Start() {
+            var directory = CreateDirectory();
+            try {
+                // Keep only keyframes, every 15 frames
+                var path = Path.Combine(directory, @"keyframes.mp4");
+                var video = CreateTrack(directory, @"vide", 1, 100, 15);
+                var track = MP4Container.CreateKeyframeTrack(video)!;
+                MP4Container.Write(CreateMovie(track), path);
+                var result = MP4Container.Read(path).tracks[0];
+                var keyframes = Enumerable.Range(0, video.samples.Count).Where(i => i % 15 == 0).ToArray();
+                Debug.Assert(result.samples.Count == keyframes.Length, $"Keyframe track has {result.samples.Count} samples but expected {keyframes.Length}");
+                Debug.Assert(result.samples.All(sample => sample.sync), @"Keyframe track has non-sync samples");
+                Debug.Assert(result.duration == video.duration, $"Keyframe track duration is {result.duration} but expected {video.duration}");
+                // Each keyframe keeps its data and start time
+                var time = 0L;
+                for (var i = 0; i < keyframes.Length && i < result.samples.Count; time += result.samples[i++].duration) {
+                    var expectedTime = video.samples.Take(keyframes[i]).Sum(sample => (long)sample.duration);
+                    Debug.Assert(time == expectedTime, $"Keyframe {i} starts at {time} but expected {expectedTime}");
+                    Debug.Assert(ReadSample(path, result.samples[i]).SequenceEqual(ReadSample(video.samples[keyframes[i]].path!, video.samples[keyframes[i]])), $"Keyframe {i} data does not match");
+                }
+                // Tracks which do not start with a keyframe cannot be decoded from their keyframes alone
+                var sample = video.samples[0];
+                sample.sync = false;
+                video.samples[0] = sample;
+                Debug.Assert(MP4Container.CreateKeyframeTrack(video) == null, @"Created keyframe track from a track which does not start with a keyframe");
+                Debug.Log(@"Keyframe track test completed");
+            } finally {
+                Directory.Delete(directory, true);
+            }
+        }
+    }
+}
\ No newline at end of file
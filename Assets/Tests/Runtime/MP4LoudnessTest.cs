@@ -0,0 +1,37 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+namespace VideoKit.Tests {
+
+    using System.IO;
+    using System.Linq;
+    using UnityEngine;
+    using Internal;
+    using static MP4TestUtility;
+
+    internal sealed class MP4LoudnessTest : MonoBehaviour {
+
+        private void Start() {
+            var directory = CreateDirectory();
+            try {
+                var path = Path.Combine(directory, @"loudness.mp4");
+                MP4Container.Write(CreateMovie(CreateTrack(directory, @"vide", 1, 30, 30), CreateTrack(directory, @"soun", 2, 50, 1)), path);
+                var audioData = ReadSamples(path, MP4Container.Read(path).tracks[1]);
+                Debug.Assert(MP4Container.ReadLoudness(path) == null, @"Loudness was read before it was written");
+                // Write loudness twice, which must replace the first one
+                MP4Container.SetLoudness(path, -16.5f, -1f, -2f);
+                Debug.Assert(MP4Container.ReadLoudness(path) == -16.5f, $"Loudness does not match: {MP4Container.ReadLoudness(path)}");
+                MP4Container.SetLoudness(path, -23f, -1f, -2f);
+                var movie = MP4Container.Read(path);
+                Debug.Assert(MP4Container.ReadLoudness(path) == -23f, $"Updated loudness does not match: {MP4Container.ReadLoudness(path)}");
+                Debug.Assert(movie.tracks[1].userData.Count == 1, $"Audio track has {movie.tracks[1].userData.Count} user data boxes");
+                Debug.Assert(ReadSamples(path, movie.tracks[1]).SequenceEqual(audioData), @"Writing loudness modified audio samples");
+                Debug.Log(@"Loudness metadata test completed");
+            } finally {
+                Directory.Delete(directory, true);
+            }
+        }
+    }
+}
\ No newline at end of file
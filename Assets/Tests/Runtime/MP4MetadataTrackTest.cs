@@ -0,0 +1,52 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+namespace VideoKit.Tests {
+
+    using System;
+    using System.Collections.Generic;
+    using System.IO;
+    using System.Linq;
+    using UnityEngine;
+    using Internal;
+    using static MP4TestUtility;
+
+    internal sealed class MP4MetadataTrackTest : MonoBehaviour {
+
+        private void Start() {
+            var directory = CreateDirectory();
+            try {
+                // Spill metadata payloads to a file, like the recorder does
+                var path = Path.Combine(directory, @"metadata.mp4");
+                var dataPath = Path.Combine(directory, @"metadata.bin");
+                var buffers = new List<(long timestamp, long offset, int size)>();
+                var payloads = new List<byte[]>();
+                using (var stream = File.Create(dataPath))
+                    for (var i = 0; i < 20; ++i) {
+                        var payload = Enumerable.Range(0, 8 + i).Select(j => (byte)(i * 7 + j)).ToArray();
+                        buffers.Add((1_000_000_000L + i * 100_000_000L, stream.Position, payload.Length));
+                        payloads.Add(payload);
+                        stream.Write(payload, 0, payload.Length);
+                    }
+                MP4Container.Write(CreateMovie(CreateTrack(directory, @"vide", 1, 60, 30)), path);
+                var videoData = ReadSamples(path, MP4Container.Read(path).tracks[0]);
+                // Add in place
+                MP4Container.AddTrack(path, MP4Container.CreateMetadataTrack(2, dataPath, buffers, 1_000_000_000L));
+                var movie = MP4Container.Read(path);
+                var metadata = MP4Container.ReadMetadata(path).ToArray();
+                Debug.Assert(movie.tracks.Count == 2, $"Movie has {movie.tracks.Count} tracks after adding metadata track");
+                Debug.Assert(ReadSamples(path, movie.tracks[0]).SequenceEqual(videoData), @"Adding metadata track modified video samples");
+                Debug.Assert(metadata.Length == payloads.Count, $"Read {metadata.Length} metadata buffers but {payloads.Count} were written");
+                for (var i = 0; i < Math.Min(metadata.Length, payloads.Count); ++i) {
+                    Debug.Assert(metadata[i].data.SequenceEqual(payloads[i]), $"Metadata buffer {i} does not match");
+                    Debug.Assert(Math.Abs(metadata[i].timestamp - i * 100_000_000L) < 100_000L, $"Metadata buffer {i} has timestamp {metadata[i].timestamp}");
+                }
+                Debug.Log(@"Metadata track test completed");
+            } finally {
+                Directory.Delete(directory, true);
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,44 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+namespace VideoKit.Tests {
+
+    using System.IO;
+    using System.Linq;
+    using UnityEngine;
+    using Internal;
+    using static MP4TestUtility;
+
+    internal sealed class MP4ReverseTest : MonoBehaviour {
+
+        private void Start() {
+            var directory = CreateDirectory();
+            try {
+                // Stream-copy each group of pictures from the end, like `MediaAsset.Reverse`
+                var source = CreateMovie(CreateTrack(directory, @"vide", 1, 100, 30));
+                var track = source.tracks[0];
+                var keyframes = Enumerable.Range(0, track.samples.Count).Where(i => track.samples[i].sync).ToList();
+                for (var g = keyframes.Count - 1; g >= 0; --g) {
+                    var start = keyframes[g];
+                    var count = (g + 1 < keyframes.Count ? keyframes[g + 1] : track.samples.Count) - start;
+                    var path = Path.Combine(directory, $"reverse_{g}.mp4");
+                    var gop = new MP4Container.Movie { fileType = source.fileType, header = source.header };
+                    var gopTrack = MP4Container.Track.CreateEmpty(track);
+                    MP4Container.AppendSamples(track, gopTrack, start, count);
+                    gop.tracks.Add(gopTrack);
+                    MP4Container.Write(gop, path);
+                    var result = MP4Container.Read(path).tracks[0];
+                    Debug.Assert(result.samples.Count == count && result.samples[0].sync, $"Group of pictures {g} has {result.samples.Count} samples");
+                    Debug.Assert(result.samples.Count(sample => sample.sync) == 1, $"Group of pictures {g} has more than one keyframe");
+                    var data = track.samples.Skip(start).Take(count).SelectMany(sample => ReadSample(sample.path!, sample));
+                    Debug.Assert(ReadSamples(path, result).SequenceEqual(data), $"Group of pictures {g} samples do not match");
+                }
+                Debug.Log(@"Reverse group of pictures test completed");
+            } finally {
+                Directory.Delete(directory, true);
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+namespace VideoKit.Tests {
+
+    using System;
+    using System.Buffers.Binary;
+    using System.Collections.Generic;
+    using System.IO;
+    using System.Linq;
+    using UnityEngine;
+    using Internal;
+
+    /// <summary>
+    /// Synthetic movies for MP4 container tests.
+    /// Sample payloads are arbitrary bytes, so movies can be written and read back without an encoder.
+    /// </summary>
+    internal static class MP4TestUtility {
+
+        public const long FrameDuration = 33_333_333L;
+
+        public static string CreateDirectory() {
+            var directory = Path.Combine(Application.temporaryCachePath, $"mp4_{Guid.NewGuid():N}");
+            Directory.CreateDirectory(directory);
+            return directory;
+        }
+
+        public static MP4Container.Movie CreateMovie(params MP4Container.Track[] tracks) {
+            var movie = new MP4Container.Movie { header = new byte[100] };
+            BinaryPrimitives.WriteUInt32BigEndian(movie.header.AsSpan(12), 1000);
+            movie.tracks.AddRange(tracks);
+            return movie;
+        }
+
+        public static MP4Container.Track CreateTrack(string directory, string handler, uint id, int count, int keyframeInterval) {
+            // Write sample data
+            var path = Path.Combine(directory, $"{handler}_{id}_{Guid.NewGuid():N}.bin");
+            var buffers = new List<(long timestamp, long offset, int size)>();
+            using (var stream = File.Create(path))
+                for (var i = 0; i < count; ++i) {
+                    var data = Enumerable.Range(0, 16 + i % 5).Select(j => (byte)(id * 31 + i + j)).ToArray();
+                    buffers.Add((i * FrameDuration, stream.Position, data.Length));
+                    stream.Write(data, 0, data.Length);
+                }
+            // Create track, reusing the metadata track headers
+            var track = MP4Container.CreateMetadataTrack(id, path, buffers, 0L);
+            track.handler = handler;
+            for (var i = 0; i < 4; ++i)
+                track.handlerReference[8 + i] = (byte)handler[i];
+            for (var i = 0; i < track.samples.Count; ++i) {
+                var sample = track.samples[i];
+                sample.sync = i % keyframeInterval == 0;
+                track.samples[i] = sample;
+            }
+            return track;
+        }
+
+        public static byte[] ReadSamples(string path, MP4Container.Track track) => track.samples
+            .SelectMany(sample => ReadSample(sample.path ?? path, sample))
+            .ToArray();
+
+        public static byte[] ReadSample(string path, MP4Container.Sample sample) {
+            if (sample.data != null)
+                return sample.data;
+            using var stream = File.OpenRead(path);
+            var data = new byte[sample.size];
+            stream.Position = sample.offset;
+            stream.Read(data, 0, data.Length);
+            return data;
+        }
+    }
+}
\ No newline at end of file
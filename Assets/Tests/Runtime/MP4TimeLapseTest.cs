@@ -0,0 +1,39 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+namespace VideoKit.Tests {
+
+    using System;
+    using System.IO;
+    using System.Linq;
+    using UnityEngine;
+    using Internal;
+    using static MP4TestUtility;
+
+    internal sealed class MP4TimeLapseTest : MonoBehaviour {
+
+        private void Start() {
+            var directory = CreateDirectory();
+            try {
+                // Keep every other keyframe for a 4x time-lapse of a video with keyframes every 3 frames
+                var path = Path.Combine(directory, @"timelapse.mp4");
+                var source = CreateTrack(directory, @"vide", 1, 300, 3);
+                var track = MP4Container.CreateTimeLapse(source, 4.0, 1.0);
+                Debug.Assert(track != null, @"Time-lapse could not be created");
+                Debug.Assert(MP4Container.CreateTimeLapse(CreateTrack(directory, @"vide", 2, 300, 300), 2.0, 1.0) == null, @"Time-lapse was created from sparse keyframes");
+                MP4Container.Write(CreateMovie(track!), path);
+                var result = MP4Container.Read(path).tracks[0];
+                Debug.Assert(result.samples.All(sample => sample.sync), @"Time-lapse contains samples which are not keyframes");
+                Debug.Assert(result.samples.Count == 50, $"Time-lapse has {result.samples.Count} samples");
+                Debug.Assert(Math.Abs(4.0 * result.duration - source.duration) < source.timescale / 100, $"Time-lapse has duration {result.duration} for source duration {source.duration}");
+                var keyframes = source.samples.Where(sample => sample.sync).Where((_, i) => i % 2 == 0).ToList();
+                Debug.Assert(ReadSamples(path, result).SequenceEqual(keyframes.SelectMany(sample => ReadSample(sample.path!, sample))), @"Time-lapse samples do not match source keyframes");
+                Debug.Log(@"Time-lapse test completed");
+            } finally {
+                Directory.Delete(directory, true);
+            }
+        }
+    }
+}
\ No newline at end of file
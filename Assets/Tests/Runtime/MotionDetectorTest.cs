@@ -0,0 +1,52 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+namespace VideoKit.Tests {
+
+    using System;
+    using UnityEngine;
+    using Internal;
+
+    internal sealed class MotionDetectorTest : MonoBehaviour {
+
+        private const int Width = 640;
+        private const int Height = 360;
+
+        private void Start() {
+            var detector = new MotionDetector(Width, Height);
+            var random = new System.Random(0);
+            // Check static frames, with sensor noise
+            var background = CreateFrame(random, 0, 0, 0);
+            var first = detector.Process(background, Width, Height, 4 * Width);
+            var noise = detector.Process(CreateFrame(random, 3, 0, 0), Width, Height, 4 * Width);
+            Debug.Assert(first == 0f, $"First frame has motion score {first}");
+            Debug.Assert(noise == 0f, $"Noisy static frame has motion score {noise}");
+            // Check a moving object covering a quarter of the frame
+            var square = detector.Process(CreateFrame(random, 3, Width / 2, Height / 2), Width, Height, 4 * Width);
+            Debug.Assert(square > 0.15f && square < 0.35f, $"Moving object has motion score {square}");
+            // Check a scene change
+            var inverted = CreateFrame(random, 0, 0, 0);
+            for (var i = 0; i < inverted.Length; ++i)
+                inverted[i] = (byte)(255 - inverted[i]);
+            var change = detector.Process(inverted, Width, Height, 4 * Width);
+            Debug.Assert(change > 0.95f, $"Scene change has motion score {change}");
+            Debug.Log($"Motion scores: {noise}, {square}, {change}");
+        }
+
+        private static byte[] CreateFrame(System.Random random, int noise, int squareWidth, int squareHeight) {
+            // Gradient background, with a white square in the top left corner
+            var frame = new byte[4 * Width * Height];
+            for (var y = 0; y < Height; ++y)
+                for (var x = 0; x < Width; ++x) {
+                    var i = 4 * (y * Width + x);
+                    var value = x < squareWidth && y < squareHeight ? 255 : 32 + 64 * y / Height;
+                    value = Math.Clamp(value + random.Next(-noise, noise + 1), 0, 255);
+                    frame[i] = frame[i + 1] = frame[i + 2] = (byte)value;
+                    frame[i + 3] = 255;
+                }
+            return frame;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+namespace VideoKit.Tests {
+
+    using System;
+    using System.Linq;
+    using UnityEngine;
+
+    internal sealed class PixelBufferStatisticsTest : MonoBehaviour {
+
+        private void Start() {
+            // Create a gray image with a dark top half and a bright bottom half
+            var data = new byte[16 * 16 * 4];
+            for (var i = 0; i < 16 * 16; ++i) {
+                var luma = i < 16 * 8 ? (byte)64 : (byte)192;
+                (data[4 * i], data[4 * i + 1], data[4 * i + 2], data[4 * i + 3]) = (luma, luma, luma, 255);
+            }
+            using var pixelBuffer = new PixelBuffer(16, 16, PixelBuffer.Format.RGBA8888, data);
+            var statistics = pixelBuffer.ComputeStatistics();
+            Debug.Assert(statistics.pixelCount == 256, $"Sampled {statistics.pixelCount} pixels");
+            Debug.Assert(statistics.histogram[64] == 128 && statistics.histogram[192] == 128, @"Histogram does not match");
+            Debug.Assert(statistics.mean == 128f, $"Mean is {statistics.mean}");
+            Debug.Assert(statistics.variance == 4096f && statistics.standardDeviation == 64f, $"Variance is {statistics.variance}");
+            Debug.Assert(statistics.min == 64 && statistics.max == 192, $"Range is [{statistics.min}, {statistics.max}]");
+            Debug.Assert(statistics.signature.Take(32).All(value => value == 64) && statistics.signature.Skip(32).All(value => value == 192), $"Signature is {string.Join(@", ", statistics.signature)}");
+            // Sampling every other pixel keeps the distribution
+            var sampled = pixelBuffer.ComputeStatistics(step: 2);
+            Debug.Assert(sampled.pixelCount == 64 && sampled.mean == 128f, $"Sampled {sampled.pixelCount} pixels with mean {sampled.mean}");
+            // Mirrored pixel buffers have their signature flipped, so they are as far as possible from the original
+            using var mirroredBuffer = new PixelBuffer(16, 16, PixelBuffer.Format.RGBA8888, data, mirrored: true);
+            var mirrored = mirroredBuffer.ComputeStatistics();
+            Debug.Assert(mirrored.signature.Take(32).All(value => value == 192), $"Mirrored signature is {string.Join(@", ", mirrored.signature)}");
+            Debug.Assert(Mathf.Abs(statistics.GetSignatureDistance(mirrored) - 128f / 255f) < 1e-6f, $"Signature distance is {statistics.GetSignatureDistance(mirrored)}");
+            Debug.Assert(statistics.GetSignatureDistance(sampled) == 0f, $"Sampled signature distance is {statistics.GetSignatureDistance(sampled)}");
+            // Red and blue are weighted by their channel order
+            var red = Enumerable.Range(0, 4).SelectMany(_ => new byte[] { 255, 0, 0, 255 }).ToArray();
+            using var rgbaBuffer = new PixelBuffer(2, 2, PixelBuffer.Format.RGBA8888, red);
+            using var bgraBuffer = new PixelBuffer(2, 2, PixelBuffer.Format.BGRA8888, red);
+            Debug.Assert(rgbaBuffer.ComputeStatistics().mean == 76f, $"Red luma is {rgbaBuffer.ComputeStatistics().mean}");
+            Debug.Assert(bgraBuffer.ComputeStatistics().mean == 28f, $"Blue luma is {bgraBuffer.ComputeStatistics().mean}");
+            // Check that invalid steps are rejected
+            try {
+                pixelBuffer.ComputeStatistics(step: 0);
+                Debug.Assert(false, @"Computed statistics with an invalid step");
+            } catch (ArgumentException) { }
+            Debug.Log(@"Pixel buffer statistics test completed");
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,59 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+namespace VideoKit.Tests {
+
+    using System;
+    using System.Linq;
+    using UnityEngine;
+
+    internal sealed class PixelBufferToTensorTest : MonoBehaviour {
+
+        private void Start() {
+            // Create a wide image with a red left half and a blue right half
+            var data = new byte[8 * 2 * 4];
+            for (var i = 0; i < 8 * 2; ++i) {
+                var red = i % 8 < 4;
+                (data[4 * i], data[4 * i + 2], data[4 * i + 3]) = (red ? (byte)255 : (byte)0, red ? (byte)0 : (byte)255, 255);
+            }
+            using var pixelBuffer = new PixelBuffer(8, 2, PixelBuffer.Format.RGBA8888, data);
+            // Letterbox into a square NCHW tensor, so the image fills rows 3 and 4
+            var tensor = new float[3 * 8 * 8];
+            var mean = new[] { 0.5f, 0.5f, 0.5f };
+            var std = new[] { 0.5f, 0.5f, 0.5f };
+            pixelBuffer.ToTensor(tensor, 8, 8, PixelBuffer.TensorLayout.NCHW, ScaleMode.ScaleToFit, mean, std);
+            for (var y = 0; y < 8; ++y) {
+                var image = y == 3 || y == 4;
+                Debug.Assert(Get(tensor, 0, y, 0) == (image ? 1f : -1f), $"Red at (0, {y}) is {Get(tensor, 0, y, 0)}");
+                Debug.Assert(Get(tensor, 2, y, 0) == -1f, $"Blue at (0, {y}) is {Get(tensor, 2, y, 0)}");
+                Debug.Assert(Get(tensor, 2, y, 7) == (image ? 1f : -1f), $"Blue at (7, {y}) is {Get(tensor, 2, y, 7)}");
+                Debug.Assert(Get(tensor, 1, y, 4) == -1f, $"Green at (4, {y}) is {Get(tensor, 1, y, 4)}");
+            }
+            // NHWC must hold the same values, interleaved
+            var interleaved = new float[tensor.Length];
+            pixelBuffer.ToTensor(interleaved, 8, 8, PixelBuffer.TensorLayout.NHWC, ScaleMode.ScaleToFit, mean, std);
+            var planar = Enumerable.Range(0, 8 * 8).SelectMany(i => new[] { tensor[i], tensor[64 + i], tensor[128 + i] });
+            Debug.Assert(interleaved.SequenceEqual(planar), @"NHWC tensor does not match NCHW tensor");
+            // Center crop fills the whole tensor with the middle of the image
+            var cropped = new float[3 * 4 * 4];
+            pixelBuffer.ToTensor(cropped, 4, 4, PixelBuffer.TensorLayout.NCHW, ScaleMode.ScaleAndCrop);
+            Debug.Assert(Mathf.Abs(cropped[0] - 1f) < 1e-5f && Mathf.Abs(cropped[2 * 16 + 3] - 1f) < 1e-5f, @"Cropped tensor does not contain image edges");
+            // Half precision must match the float tensor
+            var half = new ushort[tensor.Length];
+            pixelBuffer.ToTensor(half, 8, 8, PixelBuffer.TensorLayout.NCHW, ScaleMode.ScaleToFit, mean, std);
+            for (var i = 0; i < tensor.Length; ++i)
+                if (tensor[i] == 1f || tensor[i] == -1f)
+                    Debug.Assert(half[i] == (tensor[i] > 0f ? 0x3C00 : 0xBC00), $"Half tensor value {i} is 0x{half[i]:X4} but expected {tensor[i]}");
+            // Check that invalid tensors are rejected
+            try {
+                pixelBuffer.ToTensor(new float[10], 8, 8);
+                Debug.Assert(false, @"Converted into a tensor which is too small");
+            } catch (ArgumentException) { }
+            Debug.Log(@"Pixel buffer tensor test completed");
+        }
+
+        private static float Get(float[] tensor, int channel, int y, int x) => tensor[(channel * 8 + y) * 8 + x];
+    }
+}
\ No newline at end of file
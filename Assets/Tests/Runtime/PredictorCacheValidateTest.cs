@@ -0,0 +1,60 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+namespace VideoKit.Tests {
+
+    using System;
+    using System.IO;
+    using System.Linq;
+    using System.Security.Cryptography;
+    using UnityEngine;
+    using Internal;
+
+    internal sealed class PredictorCacheValidateTest : MonoBehaviour {
+
+        private void Start() {
+            var directory = Path.Combine(Application.temporaryCachePath, $"predictors_{Guid.NewGuid():N}");
+            var resources = Path.Combine(directory, @"resources");
+            Directory.CreateDirectory(resources);
+            try {
+                // Create intact entries
+                var valid = Write(resources, new byte[] { 1, 2, 3, 4 }, corrupt: false);
+                var named = Path.Combine(directory, @"human-texture-2.json");
+                File.WriteAllText(named, @"{}");
+                // Create corrupt entries
+                var corrupt = Write(resources, new byte[] { 5, 6, 7, 8 }, corrupt: true);
+                var partial = Path.Combine(resources, @"weights.bin.part");
+                var empty = Path.Combine(resources, @"empty.bin");
+                File.WriteAllBytes(partial, new byte[] { 9 });
+                File.WriteAllBytes(empty, Array.Empty<byte>());
+                // Validate
+                var progress = 0f;
+                var removed = PredictorCache.Validate(directory, value => progress = value);
+                Debug.Assert(removed == 3, $"Removed {removed} cache entries but expected 3");
+                Debug.Assert(File.Exists(valid) && File.Exists(named), @"Removed intact cache entries");
+                Debug.Assert(!File.Exists(corrupt) && !File.Exists(partial) && !File.Exists(empty), @"Kept corrupt cache entries");
+                Debug.Assert(progress == 1f, $"Validation progress ended at {progress}");
+                // Validate again, which must not remove anything
+                removed = PredictorCache.Validate(directory);
+                Debug.Assert(removed == 0, $"Removed {removed} cache entries from a valid cache");
+                Debug.Assert(PredictorCache.Validate(Path.Combine(directory, @"missing")) == 0, @"Removed entries from a missing cache");
+                Debug.Log(@"Predictor cache validation test completed");
+            } finally {
+                Directory.Delete(directory, true);
+            }
+        }
+
+        private static string Write(string directory, byte[] data, bool corrupt) {
+            // Name the file with the SHA-256 digest of its contents, like the predictor cache
+            using var sha256 = SHA256.Create();
+            var name = string.Concat(sha256.ComputeHash(data).Select(b => b.ToString(@"x2")));
+            var path = Path.Combine(directory, name);
+            if (corrupt)
+                data[0] ^= 0xFF;
+            File.WriteAllBytes(path, data);
+            return path;
+        }
+    }
+}
\ No newline at end of file
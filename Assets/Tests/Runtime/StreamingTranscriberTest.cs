@@ -0,0 +1,94 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+namespace VideoKit.Tests {
+
+    using System;
+    using System.Collections.Generic;
+    using System.IO;
+    using System.Linq;
+    using System.Threading.Tasks;
+    using UnityEngine;
+
+    internal sealed class StreamingTranscriberTest : MonoBehaviour {
+
+        private const int SampleRate = 16_000;
+        private const float WordDuration = 0.25f;
+
+        private async void Start() {
+            // Create transcriber which "recognizes" words encoded as sample amplitudes
+            var random = new System.Random(0);
+            var chunkDurations = new List<float>();
+            var transcriber = new StreamingTranscriber(
+                SampleRate,
+                1,
+                transcriber: async stream => {
+                    var samples = ReadWAV(stream);
+                    int delay;
+                    lock (chunkDurations) {
+                        chunkDurations.Add((float)samples.Length / SampleRate);
+                        delay = random.Next(0, 200);
+                    }
+                    await Task.Delay(delay); // finish out of order
+                    return Recognize(samples);
+                },
+                maxChunkDuration: 2f,
+                overlap: 0.5f
+            );
+            var events = new List<string>();
+            transcriber.OnTranscription += text => events.Add(text);
+            // Append two utterances, the first of which is long enough to be split
+            var (audio, expected) = CreateAudio(new[] { 0.5f, 5f, 1f, 1.5f, 1f });
+            for (var i = 0; i < audio.Length; i += 160)
+                transcriber.Append(audio.AsSpan(i, Math.Min(160, audio.Length - i)));
+            var transcript = await transcriber.FinishTranscribing();
+            // Check
+            Debug.Log($"Chunks: {string.Join(", ", chunkDurations.Select(duration => $"{duration:0.00}s"))}");
+            Debug.Log($"Transcript: {transcript}");
+            Debug.Assert(chunkDurations.Count >= 4, @"Long utterance was not split");
+            Debug.Assert(chunkDurations.All(duration => duration <= 2f), @"Chunk is longer than the maximum chunk duration");
+            Debug.Assert(transcript == expected, $"Transcript does not match, expected: {expected}");
+            Debug.Assert(string.Join(@" ", events) == transcript, @"Transcription events were raised out of order");
+        }
+
+        private static (float[] audio, string transcript) CreateAudio(float[] durations) {
+            // Alternate between silence and speech, with each word encoded as a square wave amplitude
+            var audio = new List<float>();
+            var words = new List<string>();
+            for (var i = 0; i < durations.Length; ++i) {
+                var speech = i % 2 == 1;
+                var wordSamples = (int)(WordDuration * SampleRate);
+                for (var j = 0; j < (int)(durations[i] * SampleRate); ++j) {
+                    if (speech && j % wordSamples == 0)
+                        words.Add($"w{words.Count}");
+                    var amplitude = speech ? 0.1f + 0.01f * (words.Count - 1) : 0.0001f;
+                    audio.Add(j % 2 == 0 ? amplitude : -amplitude);
+                }
+            }
+            return (audio.ToArray(), string.Join(@" ", words));
+        }
+
+        private static string Recognize(float[] samples) {
+            var words = new List<string>();
+            foreach (var sample in samples) {
+                if (Math.Abs(sample) < 0.05f)
+                    continue;
+                var word = $"w{(int)Math.Round((Math.Abs(sample) - 0.1f) / 0.01f)}";
+                if (words.Count == 0 || words[words.Count - 1] != word)
+                    words.Add(word);
+            }
+            return string.Join(@" ", words);
+        }
+
+        private static float[] ReadWAV(Stream stream) {
+            using var reader = new BinaryReader(stream);
+            stream.Position = 44;
+            var samples = new float[(stream.Length - 44) / 2];
+            for (var i = 0; i < samples.Length; ++i)
+                samples[i] = reader.ReadInt16() / (float)short.MaxValue;
+            return samples;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+namespace VideoKit.Tests {
+
+    using System;
+    using UnityEngine;
+
+    internal sealed class VoiceActivityDetectorTest : MonoBehaviour {
+
+        private void Start() {
+            // Quiet noise, a voiced tone, then quiet noise again
+            const int SampleRate = 16_000;
+            var detector = new VoiceActivityDetector(SampleRate, 1);
+            var random = new System.Random(0);
+            var noise = CreateNoise(random, SampleRate, -60f, 1f);
+            var tone = CreateTone(SampleRate, 200f, -20f, 1f);
+            var trailingNoise = CreateNoise(random, SampleRate, -60f, 1f);
+            var noiseSpeech = Process(detector, noise);
+            var toneSpeech = Process(detector, tone);
+            var trailingSpeech = Process(detector, trailingNoise);
+            Debug.Assert(noiseSpeech == 0, $"Detected speech in {noiseSpeech} of 50 noise buffers");
+            Debug.Assert(toneSpeech == 50, $"Detected speech in {toneSpeech} of 50 tone buffers");
+            // Hangover keeps reporting speech for 300ms after the tone stops
+            Debug.Assert(trailingSpeech >= 14 && trailingSpeech <= 16, $"Detected speech in {trailingSpeech} trailing noise buffers");
+            Debug.Assert(!detector.speech, @"Detector still reports speech after hangover");
+            Debug.Assert(detector.noiseFloor < -55f, $"Noise floor is {detector.noiseFloor} dBFS");
+            // Loud hiss has a high zero-crossing rate, so it is not speech
+            detector.Reset();
+            Process(detector, noise);
+            var hiss = CreateNoise(random, SampleRate, -45f, 1f);
+            var hissSpeech = Process(detector, hiss);
+            Debug.Assert(hissSpeech == 0, $"Detected speech in {hissSpeech} of 50 hiss buffers");
+            Debug.Log(@"Voice activity detector test completed");
+        }
+
+        private static int Process(VoiceActivityDetector detector, float[] data) {
+            // Process in 20ms buffers, like a microphone
+            var result = 0;
+            var bufferSize = detector.sampleRate / 50;
+            for (var offset = 0; offset < data.Length; offset += bufferSize)
+                if (detector.Process(data.AsSpan(offset, Math.Min(bufferSize, data.Length - offset))))
+                    ++result;
+            return result;
+        }
+
+        private static float[] CreateTone(int sampleRate, float frequency, float level, float duration) {
+            var amplitude = Mathf.Pow(10f, level / 20f) * Mathf.Sqrt(2f);
+            var data = new float[(int)(sampleRate * duration)];
+            for (var i = 0; i < data.Length; ++i)
+                data[i] = amplitude * Mathf.Sin(2f * Mathf.PI * frequency * i / sampleRate);
+            return data;
+        }
+
+        private static float[] CreateNoise(System.Random random, int sampleRate, float level, float duration) {
+            var amplitude = Mathf.Pow(10f, level / 20f) * Mathf.Sqrt(3f); // uniform noise with the given RMS level
+            var data = new float[(int)(sampleRate * duration)];
+            for (var i = 0; i < data.Length; ++i)
+                data[i] = amplitude * (2f * (float)random.NextDouble() - 1f);
+            return data;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,125 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+#nullable enable
+
+namespace VideoKit {
+
+    using System;
+
+    /// <summary>
+    /// Real-time audio limiter with optional automatic gain control.
+    /// The limiter reacts instantly to peaks so that the output never exceeds the ceiling,
+    /// while automatic gain control slowly steers the short-term loudness towards a target.
+    /// </summary>
+    public sealed class AudioLimiter {
+
+        #region --Client API--
+        /// <summary>
+        /// Limiter sample rate.
+        /// </summary>
+        public readonly int sampleRate;
+
+        /// <summary>
+        /// Limiter channel count.
+        /// </summary>
+        public readonly int channelCount;
+
+        /// <summary>
+        /// Peak ceiling in dBFS.
+        /// </summary>
+        public float ceiling;
+
+        /// <summary>
+        /// Target loudness in LUFS for automatic gain control.
+        /// When `null`, automatic gain control is disabled and audio is only limited.
+        /// </summary>
+        public float? targetLoudness;
+
+        /// <summary>
+        /// Maximum gain in dB that automatic gain control can apply.
+        /// </summary>
+        public float maxGain = 12f;
+
+        /// <summary>
+        /// Current automatic gain control gain in dB.
+        /// </summary>
+        public float gain => 20f * MathF.Log10(agcGain);
+
+        /// <summary>
+        /// Current limiter gain reduction in dB.
+        /// </summary>
+        public float gainReduction => -20f * MathF.Log10(envelope);
+
+        /// <summary>
+        /// Create an audio limiter.
+        /// </summary>
+        /// <param name="sampleRate">Audio sample rate.</param>
+        /// <param name="channelCount">Audio channel count.</param>
+        /// <param name="ceiling">Peak ceiling in dBFS.</param>
+        /// <param name="targetLoudness">Target loudness in LUFS for automatic gain control. Pass `null` to disable automatic gain control.</param>
+        public AudioLimiter(
+            int sampleRate,
+            int channelCount,
+            float ceiling = -1f,
+            float? targetLoudness = null
+        ) {
+            // Check
+            if (sampleRate <= 0 || channelCount <= 0)
+                throw new ArgumentException($"Cannot create audio limiter because format is invalid: {sampleRate}Hz {channelCount}ch");
+            // Create
+            this.sampleRate = sampleRate;
+            this.channelCount = channelCount;
+            this.ceiling = ceiling;
+            this.targetLoudness = targetLoudness;
+            this.meter = new LoudnessMeter(sampleRate, channelCount);
+            this.releaseCoefficient = 1f - MathF.Exp(-1f / (0.1f * sampleRate));  // 100ms
+            this.agcCoefficient = 1f - MathF.Exp(-1f / (2f * sampleRate));        // 2s
+        }
+
+        /// <summary>
+        /// Process interleaved linear PCM audio in place.
+        /// </summary>
+        /// <param name="data">Interleaved audio samples with the same format as the limiter.</param>
+        public void Process(Span<float> data) {
+            // Update automatic gain control target from the input loudness
+            var target = targetLoudness;
+            if (target != null) {
+                meter.Append(data);
+                var loudness = meter.shortTermLoudness;
+                if (float.IsNegativeInfinity(loudness))
+                    loudness = meter.momentaryLoudness;
+                if (loudness > SilenceThreshold) // don't amplify silence or noise floor
+                    agcTarget = MathF.Pow(10f, Math.Clamp(target.Value - loudness, -maxGain, maxGain) / 20f);
+            } else
+                agcTarget = 1f;
+            // Limit
+            var ceiling = MathF.Pow(10f, this.ceiling / 20f);
+            for (var i = 0; i + channelCount <= data.Length; i += channelCount) {
+                agcGain += (agcTarget - agcGain) * agcCoefficient;
+                var peak = 0f;
+                for (var c = 0; c < channelCount; ++c)
+                    peak = MathF.Max(peak, MathF.Abs(data[i + c] * agcGain));
+                var required = peak > ceiling ? ceiling / peak : 1f;
+                envelope = required < envelope ? required : envelope + (required - envelope) * releaseCoefficient;
+                var gain = agcGain * envelope;
+                for (var c = 0; c < channelCount; ++c)
+                    data[i + c] *= gain;
+            }
+        }
+        #endregion
+
+
+        #region --Operations--
+        private readonly LoudnessMeter meter;
+        private readonly float releaseCoefficient;
+        private readonly float agcCoefficient;
+        private float agcTarget = 1f;
+        private float agcGain = 1f;
+        private float envelope = 1f;
+        private const float SilenceThreshold = -50f;
+        #endregion
+    }
+}
\ No newline at end of file
@@ -0,0 +1,220 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+#nullable enable
+
+namespace VideoKit {
+
+    using System;
+    using System.Collections.Generic;
+    using System.IO;
+    using System.Linq;
+    using System.Numerics;
+    using System.Runtime.InteropServices;
+    using Unity.Collections.LowLevel.Unsafe;
+
+    /// <summary>
+    /// Audio spectrogram, with the magnitude spectrum of successive Hann-windowed frames of the audio.
+    /// Channels are mixed down to mono before analysis.
+    /// </summary>
+    public sealed class AudioSpectrogram {
+
+        #region --Client API--
+        /// <summary>
+        /// FFT size in samples.
+        /// </summary>
+        public readonly int fftSize;
+
+        /// <summary>
+        /// Number of samples between successive frames.
+        /// </summary>
+        public readonly int hopSize;
+
+        /// <summary>
+        /// Audio sample rate.
+        /// </summary>
+        public readonly int sampleRate;
+
+        /// <summary>
+        /// Magnitudes in dBFS, with the bins of each frame stored contiguously.
+        /// </summary>
+        public readonly float[] data;
+
+        /// <summary>
+        /// Number of frequency bins in each frame.
+        /// </summary>
+        public int binCount => fftSize / 2 + 1;
+
+        /// <summary>
+        /// Number of frames.
+        /// </summary>
+        public int frameCount => data.Length / binCount;
+
+        /// <summary>
+        /// Get the magnitude of a frequency bin in a frame.
+        /// </summary>
+        /// <param name="frame">Frame index.</param>
+        /// <param name="bin">Frequency bin index.</param>
+        /// <returns>Magnitude in dBFS.</returns>
+        public float this[int frame, int bin] => data[frame * binCount + bin];
+
+        /// <summary>
+        /// Get the frequency of a bin.
+        /// </summary>
+        /// <param name="bin">Frequency bin index.</param>
+        /// <returns>Frequency in Hz.</returns>
+        public float GetFrequency(int bin) => (float)bin * sampleRate / fftSize;
+        #endregion
+
+
+        #region --Operations--
+        private const int Magic = 0x50534B56; // 'VKSP'
+
+        private AudioSpectrogram(int fftSize, int hopSize, int sampleRate, float[] data) {
+            this.fftSize = fftSize;
+            this.hopSize = hopSize;
+            this.sampleRate = sampleRate;
+            this.data = data;
+        }
+
+        internal static unsafe AudioSpectrogram Compute(
+            IEnumerable<AudioBuffer> audioBuffers,
+            int fftSize,
+            int hopSize
+        ) {
+            var fft = new FFT(fftSize);
+            var frame = new float[fftSize];
+            var frameLength = 0;
+            var skip = 0;
+            var magnitudes = new float[fftSize / 2 + 1];
+            var result = new List<float>();
+            var sampleRate = 0;
+            foreach (var audioBuffer in audioBuffers) {
+                var channelCount = Math.Max(audioBuffer.channelCount, 1);
+                var data = audioBuffer.data;
+                var samples = new ReadOnlySpan<float>(data.GetUnsafeReadOnlyPtr(), data.Length);
+                sampleRate = audioBuffer.sampleRate;
+                for (var i = 0; i + channelCount <= samples.Length; i += channelCount) {
+                    // Skip samples between frames which are further apart than the FFT size
+                    if (skip > 0) {
+                        --skip;
+                        continue;
+                    }
+                    // Downmix
+                    var sample = 0f;
+                    for (var c = 0; c < channelCount; ++c)
+                        sample += samples[i + c];
+                    frame[frameLength++] = sample / channelCount;
+                    if (frameLength < fftSize)
+                        continue;
+                    // Analyze
+                    fft.Forward(frame, magnitudes);
+                    result.AddRange(magnitudes);
+                    // Advance
+                    var keep = Math.Max(fftSize - hopSize, 0);
+                    Array.Copy(frame, fftSize - keep, frame, 0, keep);
+                    frameLength = keep;
+                    skip = Math.Max(hopSize - fftSize, 0);
+                }
+            }
+            return new AudioSpectrogram(fftSize, hopSize, sampleRate, result.ToArray());
+        }
+
+        internal void Write(Stream stream) {
+            using var writer = new BinaryWriter(stream);
+            writer.Write(Magic);
+            writer.Write(fftSize);
+            writer.Write(hopSize);
+            writer.Write(sampleRate);
+            writer.Write(data.Length);
+            writer.Write(MemoryMarshal.AsBytes(data.AsSpan()));
+        }
+
+        internal static AudioSpectrogram? Read(Stream stream, int fftSize, int hopSize) {
+            using var reader = new BinaryReader(stream);
+            if (reader.ReadInt32() != Magic || reader.ReadInt32() != fftSize || reader.ReadInt32() != hopSize)
+                return null;
+            var sampleRate = reader.ReadInt32();
+            var data = new float[reader.ReadInt32()];
+            var bytes = MemoryMarshal.AsBytes(data.AsSpan());
+            if (reader.Read(bytes) != bytes.Length)
+                return null;
+            return new AudioSpectrogram(fftSize, hopSize, sampleRate, data);
+        }
+
+        private sealed class FFT {
+
+            public FFT(int size) {
+                this.size = size;
+                this.window = new float[size];
+                this.real = new float[size];
+                this.imaginary = new float[size];
+                this.cos = new float[size / 2];
+                this.sin = new float[size / 2];
+                this.reversed = new int[size];
+                for (var i = 0; i < size; ++i)
+                    window[i] = 0.5f - 0.5f * MathF.Cos(2f * MathF.PI * i / size);
+                for (var i = 0; i < size / 2; ++i) {
+                    cos[i] = MathF.Cos(2f * MathF.PI * i / size);
+                    sin[i] = -MathF.Sin(2f * MathF.PI * i / size);
+                }
+                var bits = 0;
+                while ((1 << bits) < size)
+                    ++bits;
+                for (var i = 0; i < size; ++i) {
+                    var r = 0;
+                    for (var b = 0; b < bits; ++b)
+                        r |= ((i >> b) & 1) << (bits - 1 - b);
+                    reversed[i] = r;
+                }
+                // Normalize so that a full scale sine wave peaks at 0dBFS
+                this.scale = 2f / window.Sum();
+            }
+
+            public void Forward(float[] samples, float[] magnitudes) {
+                // Apply window
+                var vectorSize = Vector<float>.Count;
+                var i = 0;
+                for (; i + vectorSize <= size; i += vectorSize)
+                    (new Vector<float>(samples, i) * new Vector<float>(window, i)).CopyTo(imaginary, i);
+                for (; i < size; ++i)
+                    imaginary[i] = samples[i] * window[i];
+                // Reorder
+                for (i = 0; i < size; ++i)
+                    real[reversed[i]] = imaginary[i];
+                Array.Clear(imaginary, 0, size);
+                // Butterflies
+                for (var length = 2; length <= size; length <<= 1) {
+                    var half = length >> 1;
+                    var step = size / length;
+                    for (var start = 0; start < size; start += length)
+                        for (var k = 0; k < half; ++k) {
+                            var (wr, wi) = (cos[k * step], sin[k * step]);
+                            var (a, b) = (start + k, start + k + half);
+                            var tr = wr * real[b] - wi * imaginary[b];
+                            var ti = wr * imaginary[b] + wi * real[b];
+                            (real[b], imaginary[b]) = (real[a] - tr, imaginary[a] - ti);
+                            (real[a], imaginary[a]) = (real[a] + tr, imaginary[a] + ti);
+                        }
+                }
+                // Compute magnitudes
+                for (i = 0; i < magnitudes.Length; ++i) {
+                    var power = (real[i] * real[i] + imaginary[i] * imaginary[i]) * scale * scale;
+                    magnitudes[i] = 10f * MathF.Log10(power + 1e-20f);
+                }
+            }
+
+            private readonly int size;
+            private readonly float[] window;
+            private readonly float[] real;
+            private readonly float[] imaginary;
+            private readonly float[] cos;
+            private readonly float[] sin;
+            private readonly int[] reversed;
+            private readonly float scale;
+        }
+        #endregion
+    }
+}
\ No newline at end of file
@@ -0,0 +1,151 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+#nullable enable
+
+namespace VideoKit {
+
+    using System;
+    using System.Collections.Generic;
+    using System.IO;
+    using System.Numerics;
+    using System.Runtime.InteropServices;
+    using Unity.Collections.LowLevel.Unsafe;
+
+    /// <summary>
+    /// Audio waveform summary, with the minimum, maximum, and RMS sample values over evenly spaced buckets.
+    /// This is typically used to draw waveforms in editor UI.
+    /// </summary>
+    public sealed class AudioWaveform {
+
+        #region --Client API--
+        /// <summary>
+        /// Minimum sample value in each bucket.
+        /// </summary>
+        public readonly float[] min;
+
+        /// <summary>
+        /// Maximum sample value in each bucket.
+        /// </summary>
+        public readonly float[] max;
+
+        /// <summary>
+        /// RMS sample value in each bucket.
+        /// </summary>
+        public readonly float[] rms;
+
+        /// <summary>
+        /// Audio duration in seconds.
+        /// </summary>
+        public readonly float duration;
+
+        /// <summary>
+        /// Number of buckets.
+        /// </summary>
+        public int bucketCount => min.Length;
+        #endregion
+
+
+        #region --Operations--
+        private const int Magic = 0x46574B56; // 'VKWF'
+
+        private AudioWaveform(float[] min, float[] max, float[] rms, float duration) {
+            this.min = min;
+            this.max = max;
+            this.rms = rms;
+            this.duration = duration;
+        }
+
+        internal static unsafe AudioWaveform Compute(
+            IEnumerable<AudioBuffer> audioBuffers,
+            int bucketCount,
+            long frameCount
+        ) {
+            var min = new float[bucketCount];
+            var max = new float[bucketCount];
+            var sums = new double[bucketCount];
+            var counts = new long[bucketCount];
+            var frame = 0L;
+            var sampleRate = 0;
+            frameCount = Math.Max(frameCount, 1L);
+            foreach (var audioBuffer in audioBuffers) {
+                var channelCount = audioBuffer.channelCount;
+                var data = audioBuffer.data;
+                var samples = new ReadOnlySpan<float>(data.GetUnsafeReadOnlyPtr(), data.Length);
+                var frames = samples.Length / Math.Max(channelCount, 1);
+                sampleRate = audioBuffer.sampleRate;
+                // Reduce each run of frames which falls in the same bucket
+                for (var offset = 0; offset < frames;) {
+                    var bucket = (int)Math.Min((frame + offset) * bucketCount / frameCount, bucketCount - 1);
+                    var bucketEnd = bucket < bucketCount - 1 ?
+                        ((bucket + 1) * frameCount + bucketCount - 1) / bucketCount :
+                        long.MaxValue;
+                    var count = (int)Math.Max(Math.Min(bucketEnd - frame, frames) - offset, 1);
+                    var run = samples.Slice(offset * channelCount, count * channelCount);
+                    if (counts[bucket] == 0)
+                        (min[bucket], max[bucket]) = (run[0], run[0]);
+                    Reduce(run, ref min[bucket], ref max[bucket], ref sums[bucket]);
+                    counts[bucket] += run.Length;
+                    offset += count;
+                }
+                frame += frames;
+            }
+            // Compute RMS
+            var rms = new float[bucketCount];
+            for (var i = 0; i < bucketCount; ++i)
+                rms[i] = counts[i] > 0 ? (float)Math.Sqrt(sums[i] / counts[i]) : 0f;
+            // Return
+            var duration = sampleRate > 0 ? (float)frame / sampleRate : 0f;
+            return new AudioWaveform(min, max, rms, duration);
+        }
+
+        internal void Write(Stream stream) {
+            using var writer = new BinaryWriter(stream);
+            writer.Write(Magic);
+            writer.Write(bucketCount);
+            writer.Write(duration);
+            foreach (var values in new[] { min, max, rms })
+                writer.Write(MemoryMarshal.AsBytes(values.AsSpan()));
+        }
+
+        internal static AudioWaveform? Read(Stream stream, int bucketCount) {
+            using var reader = new BinaryReader(stream);
+            if (reader.ReadInt32() != Magic || reader.ReadInt32() != bucketCount)
+                return null;
+            var duration = reader.ReadSingle();
+            var values = new float[3][];
+            for (var i = 0; i < values.Length; ++i) {
+                values[i] = new float[bucketCount];
+                var bytes = MemoryMarshal.AsBytes(values[i].AsSpan());
+                if (reader.Read(bytes) != bytes.Length)
+                    return null;
+            }
+            return new AudioWaveform(values[0], values[1], values[2], duration);
+        }
+
+        private static void Reduce(ReadOnlySpan<float> samples, ref float min, ref float max, ref double sum) {
+            var vectors = MemoryMarshal.Cast<float, Vector<float>>(samples);
+            var vectorMin = new Vector<float>(min);
+            var vectorMax = new Vector<float>(max);
+            var vectorSum = Vector<float>.Zero;
+            foreach (var vector in vectors) {
+                vectorMin = Vector.Min(vectorMin, vector);
+                vectorMax = Vector.Max(vectorMax, vector);
+                vectorSum += vector * vector;
+            }
+            for (var i = 0; i < Vector<float>.Count; ++i) {
+                min = MathF.Min(min, vectorMin[i]);
+                max = MathF.Max(max, vectorMax[i]);
+            }
+            sum += Vector.Dot(vectorSum, Vector<float>.One);
+            for (var i = vectors.Length * Vector<float>.Count; i < samples.Length; ++i) {
+                min = MathF.Min(min, samples[i]);
+                max = MathF.Max(max, samples[i]);
+                sum += samples[i] * samples[i];
+            }
+        }
+        #endregion
+    }
+}
\ No newline at end of file
@@ -13,6 +13,7 @@ namespace VideoKit {
     using System.Linq;
     using System.Threading.Tasks;
     using UnityEngine;
+    using Muna;
     using Internal;
 
     /// <summary>
@@ -230,6 +231,22 @@ namespace VideoKit {
         /// </summary>
         public bool running => _device?.running ?? false;
 
+        /// <summary>
+        /// Human texture predictor loading progress in range [0, 1].
+        /// When the camera manager has the `HumanTexture` capability, the predictor is loaded in the background
+        /// while the camera starts running, so the camera preview is never delayed by model loading.
+        /// NOTE: The predictor download does not report progress, so this stays at zero while the predictor loads and becomes one once it is ready.
+        /// It only moves in between while the predictor cache is being verified after a failed load.
+        /// </summary>
+        public float humanTextureProgress { get; private set; }
+
+        /// <summary>
+        /// Error which caused the human texture predictor to fail loading, or `null` if it has not failed.
+        /// When this is set, camera views in the `HumanTexture` view mode show a transparent texture instead of the camera.
+        /// The predictor is loaded again the next time the camera starts running.
+        /// </summary>
+        public Exception? humanTextureError { get; private set; }
+
         /// <summary>
         /// Event raised when a new pixel buffer is provided by the camera device.
         /// NOTE: This event is invoked on a dedicated camera thread, not the Unity main thread.
@@ -271,19 +288,11 @@ namespace VideoKit {
                 if (cameraDevice.IsExposureModeSupported(exposureMode))
                     cameraDevice.exposureMode = exposureMode;
             }
-            // Preload human texture predictor
-            var muna = VideoKitClient.Instance!.muna;
-            if (capabilities.HasFlag(Capabilities.HumanTexture)) {
-                try { await muna.Predictions.Create(HumanTextureTag, new()); }
-                catch { // CHECK // REMOVE
-                    var predictorCachePath = Path.Join(Application.persistentDataPath, @"fxn", @"predictors");
-                    if (Directory.Exists(predictorCachePath))
-                        Directory.Delete(predictorCachePath, recursive: true);
-                }
-                await muna.Predictions.Create(HumanTextureTag, new());
-            }
             // Start running
             StartRunning(_device, OnCameraBuffer);
+            // Load human texture predictor in the background
+            if (capabilities.HasFlag(Capabilities.HumanTexture))
+                humanTextureTask ??= LoadHumanTexturePredictor();
             // Listen for events
             var events = VideoKitEvents.Instance;
             events.onPause += OnPause;
@@ -312,13 +321,50 @@ namespace VideoKit {
         #region --Operations--
         private MediaDevice[]? devices;
         private MediaDevice? _device;
+        private Task? humanTextureTask;
         internal const string HumanTextureTag = @"@videokit/human-texture-2";
 
+        internal bool humanTextureReady => !capabilities.HasFlag(Capabilities.HumanTexture) || humanTextureProgress >= 1f;
+
         private void Awake() {
             if (playOnAwake)
                 StartRunning();
         }
 
+        private async Task LoadHumanTexturePredictor() {
+            var muna = VideoKitClient.Instance!.muna;
+            var cachePath = Path.Join(Application.persistentDataPath, @"fxn", @"predictors");
+            humanTextureProgress = 0f;
+            humanTextureError = null;
+            var error = await LoadHumanTexturePredictor(muna);
+            if (error != null) {
+                // Remove only the corrupt cache entries, then retry
+                var removed = await Task.Run(() => PredictorCache.Validate(
+                    cachePath,
+                    progress => humanTextureProgress = 0.9f * progress
+                ));
+                Debug.LogWarning($"VideoKit: Camera manager failed to load human texture predictor so {removed} corrupt cache entries were removed before retrying: {error.Message}");
+                error = await LoadHumanTexturePredictor(muna);
+            }
+            // Check
+            if (error != null) {
+                Debug.LogError($"VideoKit: Camera manager failed to load human texture predictor: {error.Message}");
+                humanTextureError = error;
+                humanTextureTask = null;
+                return;
+            }
+            humanTextureProgress = 1f;
+        }
+
+        private static async Task<Exception?> LoadHumanTexturePredictor(Muna muna) {
+            try {
+                await muna.Predictions.Create(HumanTextureTag, new());
+                return null;
+            } catch (Exception ex) {
+                return ex;
+            }
+        }
+
         private static void StartRunning(
             MediaDevice device,
             Action<CameraDevice, PixelBuffer> handler
@@ -91,6 +91,14 @@ namespace VideoKit.UI {
         [Tooltip(@"View mode of the view.")]
         public ViewMode viewMode = ViewMode.CameraTexture;
 
+        /// <summary>
+        /// Maximum resolution of the image used to predict the human texture.
+        /// The predicted mask is upsampled to the preview resolution with an edge-aware filter guided by the camera image.
+        /// Set this to zero to predict the human texture at the full preview resolution.
+        /// </summary>
+        [Tooltip(@"Maximum resolution of the image used to predict the human texture. Set this to zero to use the full preview resolution.")]
+        public int humanTextureResolution = 256;
+
         [Header(@"Gestures")]
         /// <summary>
         /// Focus gesture.
@@ -149,6 +157,7 @@ namespace VideoKit.UI {
 
         #region --Operations--
         private PixelBuffer pixelBuffer;
+        private GuidedMaskUpsampler? upsampler;
         private RawImage rawImage;
         private AspectRatioFitter aspectFitter;
         private readonly object fence = new();
@@ -191,25 +200,55 @@ namespace VideoKit.UI {
                         TextureFormat.RGBA32,
                         false
                     );
-                if (viewMode == ViewMode.CameraTexture) {
+                var humanTexture = viewMode == ViewMode.HumanTexture && (cameraManager?.humanTextureReady ?? true);
+                var humanTextureFailed = viewMode == ViewMode.HumanTexture && cameraManager?.humanTextureError != null;
+                if (humanTextureFailed) { // show nothing instead of the unsegmented camera
+                    var textureData = texture.GetRawTextureData<byte>();
+                    UnsafeUtility.MemClear(textureData.GetUnsafePtr(), textureData.Length);
+                    upload = true;
+                } else if (viewMode == ViewMode.CameraTexture || !humanTexture) { // show the camera until the human texture predictor is loaded
                     using var buffer = new PixelBuffer(texture);
                     pixelBuffer.CopyTo(buffer);
                     upload = true;
-                } else if (viewMode == ViewMode.HumanTexture) {
+                } else {
                     var muna = VideoKitClient.Instance!.muna;
+                    var upsampler = GetHumanTextureUpsampler();
+                    var data = pixelBuffer.data;
                     var prediction = muna.Predictions.Create(
                         tag: VideoKitCameraManager.HumanTextureTag,
                         inputs: new () {
-                            ["image"] = new Image(
-                                (byte*)pixelBuffer.data.GetUnsafePtr(),
-                                pixelBuffer.width,
-                                pixelBuffer.height,
-                                4
-                            )
+                            ["image"] = upsampler != null ?
+                                new Image(
+                                    upsampler.Downsample(
+                                        new ReadOnlySpan<byte>(data.GetUnsafeReadOnlyPtr(), data.Length),
+                                        pixelBuffer.rowStride
+                                    ),
+                                    upsampler.inputWidth,
+                                    upsampler.inputHeight,
+                                    4
+                                ) :
+                                new Image(
+                                    (byte*)data.GetUnsafePtr(),
+                                    pixelBuffer.width,
+                                    pixelBuffer.height,
+                                    4
+                                )
                         }
                     ).Throw().Result;
                     var image = (Image)prediction.results![0]!;
-                    image.CopyTo(texture);
+                    if (upsampler != null) {
+                        var textureData = texture.GetRawTextureData<byte>();
+                        upsampler.Upsample(
+                            image.data,
+                            image.width,
+                            image.height,
+                            image.channels,
+                            new ReadOnlySpan<byte>(data.GetUnsafeReadOnlyPtr(), data.Length),
+                            pixelBuffer.rowStride,
+                            new Span<byte>(textureData.GetUnsafePtr(), textureData.Length)
+                        );
+                    } else
+                        image.CopyTo(texture);
                     upload = true;
                 }
             }
@@ -259,6 +298,21 @@ namespace VideoKit.UI {
         private void OnDestroy() {
             pixelBuffer.Dispose();
             pixelBuffer = default;
+            upsampler = null;
+        }
+
+        private GuidedMaskUpsampler? GetHumanTextureUpsampler() {
+            var (width, height) = (pixelBuffer.width, pixelBuffer.height);
+            if (humanTextureResolution <= 0 || humanTextureResolution >= Math.Max(width, height))
+                return null;
+            if (
+                upsampler == null ||
+                upsampler.width != width ||
+                upsampler.height != height ||
+                upsampler.resolution != humanTextureResolution
+            )
+                upsampler = new GuidedMaskUpsampler(width, height, humanTextureResolution);
+            return upsampler;
         }
         #endregion
 
@@ -16,6 +16,7 @@ namespace VideoKit {
     using UnityEngine.Serialization;
     using Unity.Collections;
     using Clocks;
+    using Internal;
     using Sources;
     using UI;
     using MediaFormat = MediaRecorder.Format;
@@ -57,7 +58,9 @@ namespace VideoKit {
 
         /// <summary>
         /// Audio recording mode.
+        /// Multiple modes can be combined, in which case the audio inputs are mixed together.
         /// </summary>
+        [Flags]
         public enum AudioMode : int {
             /// <summary>
             /// Don't record audio.
@@ -351,7 +354,6 @@ namespace VideoKit {
         [Header(@"Watermark")]
         /// <summary>
         /// Recording watermark mode for adding a watermark to videos.
-        /// NOTE: Watermarking is not supported with the `VideoMode.CameraDevice` video mode.
         /// </summary>
         [Tooltip(@"Recording watermark mode for adding a watermark to videos.")]
         public WatermarkMode watermarkMode = WatermarkMode.None;
@@ -368,6 +370,13 @@ namespace VideoKit {
         [SerializeField, FormerlySerializedAs(@"watermarkRect"), Tooltip(@"Watermark display rect when `watermarkMode` is set to `WatermarkMode.Custom`")]
         private Rect _watermarkRect;
 
+        /// <summary>
+        /// Whether to render the date and time in the upper-left of each frame.
+        /// NOTE: This is only supported with the `VideoMode.CameraDevice` video mode.
+        /// </summary>
+        [Tooltip(@"Whether to render the date and time in the upper-left of each frame.")]
+        public bool watermarkTimestamp = false;
+
         [Header(@"Audio")]
         /// <summary>
         /// Audio recording mode.
@@ -490,16 +499,14 @@ namespace VideoKit {
                     _                                       => 30,
                 };
                 var sampleRate = audioMode switch {
+                    AudioMode.None              => 0,
                     AudioMode.AudioDevice       => audioManager?.device?.sampleRate ?? 0,
-                    AudioMode.AudioListener     => AudioSettings.outputSampleRate,
-                    AudioMode.AudioSource       => AudioSettings.outputSampleRate,
-                    _                           => 0,
+                    _                           => AudioSettings.outputSampleRate, // multiple inputs are mixed at the Unity sample rate
                 };
                 var channelCount = audioMode switch {
+                    AudioMode.None              => 0,
                     AudioMode.AudioDevice       => audioManager?.device?.channelCount ?? 0,
-                    AudioMode.AudioListener     => (int)AudioSettings.speakerMode,
-                    AudioMode.AudioSource       => (int)AudioSettings.speakerMode,
-                    _                           => 0,
+                    _                           => (int)AudioSettings.speakerMode,
                 };
                 return new Configuration {
                     width = width,
@@ -525,6 +532,8 @@ namespace VideoKit {
                 var textureSource = GetTextureSource(videoInput);
                 if (textureSource != null)
                     textureSource.watermark = value;
+                if (videoInput is CameraViewSource && recorder != null)
+                    ApplyWatermark(videoInput, recorder.width, recorder.height);
             }
         }
 
@@ -560,6 +569,8 @@ namespace VideoKit {
                         Mathf.RoundToInt(value.width * width),
                         Mathf.RoundToInt(value.height * height)
                     );
+                if (videoInput is CameraViewSource && recorder != null)
+                    ApplyWatermark(videoInput, recorder.width, recorder.height);
             }
         }
 
@@ -643,13 +654,9 @@ namespace VideoKit {
             // Create inputs
             clock = new RealtimeClock();
             videoInput = recorder.canAppendPixelBuffer ? CreateVideoInput(recorder.width, recorder.height, recorder.Append) : null;
-            audioInput = recorder.canAppendAudioBuffer ? CreateAudioInput(recorder.Append) : null;
+            audioInput = recorder.canAppendAudioBuffer ? CreateAudioInput(recorder.sampleRate, recorder.channelCount, recorder.Append) : null;
             // Apply watermark
-            var textureSource = GetTextureSource(videoInput);
-            if (textureSource != null) {
-                textureSource.watermark = watermark;
-                textureSource.watermarkRect = CreateWatermarkRect(recorder.width, recorder.height);
-            }
+            ApplyWatermark(videoInput, recorder.width, recorder.height);
         }
 
         /// <summary>
@@ -701,13 +708,9 @@ namespace VideoKit {
             clock!.paused = false;
             // Create inputs
             videoInput = recorder.canAppendPixelBuffer ? CreateVideoInput(recorder.width, recorder.height, recorder.Append) : null;
-            audioInput = recorder.canAppendAudioBuffer ? CreateAudioInput(recorder.Append) : null;
+            audioInput = recorder.canAppendAudioBuffer ? CreateAudioInput(recorder.sampleRate, recorder.channelCount, recorder.Append) : null;
             // Apply watermark
-            var textureSource = GetTextureSource(videoInput);
-            if (textureSource != null) {
-                textureSource.watermark = watermark;
-                textureSource.watermarkRect = CreateWatermarkRect(recorder.width, recorder.height);
-            }
+            ApplyWatermark(videoInput, recorder.width, recorder.height);
         }
 
         /// <summary>
@@ -772,11 +775,7 @@ namespace VideoKit {
                     recorder.Append(pixelBuffer);
                     tcs.SetResult(true);
                 });
-                var textureSource = GetTextureSource(source);
-                if (textureSource != null) {
-                    textureSource.watermark = watermark;
-                    textureSource.watermarkRect = CreateWatermarkRect(recorder.width, recorder.height);
-                }
+                ApplyWatermark(source, recorder.width, recorder.height);
                 await tcs.Task;
             }
             var sequenceAsset = await recorder.FinishWriting();
@@ -821,17 +820,68 @@ namespace VideoKit {
             _ => null,
         };
 
-        private IDisposable? CreateAudioInput(Action<AudioBuffer> handler) =>  audioMode switch {
+        private IDisposable? CreateAudioInput(
+            int sampleRate,
+            int channelCount,
+            Action<AudioBuffer> handler
+        ) {
+            // Check single input
+            var modes = new List<AudioMode>();
+            foreach (var mode in new [] { AudioMode.AudioDevice, AudioMode.AudioListener, AudioMode.AudioSource })
+                if (audioMode.HasFlag(mode))
+                    modes.Add(mode);
+            if (modes.Count < 2)
+                return CreateAudioInput(audioMode, handler);
+            // Mix inputs
+            var mixer = new AudioMixerSource(sampleRate, channelCount, handler);
+            var inputs = new List<IDisposable>();
+            foreach (var mode in modes)
+                inputs.Add(CreateAudioInput(mode, mixer.CreateInput())!);
+            inputs.Add(mixer); // dispose last so that remaining audio is mixed
+            return new AudioInputGroup(inputs.ToArray());
+        }
+
+        private IDisposable? CreateAudioInput(
+            AudioMode audioMode,
+            Action<AudioBuffer> handler
+        ) => audioMode switch {
             AudioMode.AudioDevice   => new AudioManagerSource(audioManager!, handler, clock),
             AudioMode.AudioListener => new AudioComponentSource(audioListener!, handler, clock),
             AudioMode.AudioSource   => new AudioComponentSource(audioSource!, handler, clock),
             _                       => null,
         };
+
+        private sealed class AudioInputGroup : IDisposable {
+            private readonly IDisposable[] inputs;
+            public AudioInputGroup(IDisposable[] inputs) => this.inputs = inputs;
+            public void Dispose() {
+                foreach (var input in inputs)
+                    input.Dispose();
+            }
+        }
         #endregion
 
 
         #region --Utility--
 
+        private void ApplyWatermark(IDisposable? videoInput, int width, int height) {
+            var watermark = this.watermark;
+            var watermarkRect = CreateWatermarkRect(width, height);
+            // Texture sources render the watermark on the GPU
+            var textureSource = GetTextureSource(videoInput);
+            if (textureSource != null) {
+                textureSource.watermark = watermark;
+                textureSource.watermarkRect = watermarkRect;
+            }
+            // Camera device frames are composited on the CPU
+            if (videoInput is CameraViewSource cameraViewSource) {
+                var overlay = new PixelBufferOverlay { timestamp = watermarkTimestamp };
+                if (watermark != null)
+                    overlay.SetImage(watermark, TextureSource.AspectFitRect(watermark, watermarkRect));
+                cameraViewSource.overlay = overlay.isEmpty ? null : overlay;
+            }
+        }
+
         private RectInt CreateWatermarkRect(int width, int height) {
             // Check none
             if (watermarkMode == WatermarkMode.None)
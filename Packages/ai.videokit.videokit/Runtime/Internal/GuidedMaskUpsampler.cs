@@ -0,0 +1,265 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+#nullable enable
+
+namespace VideoKit.Internal {
+
+    using System;
+    using System.Numerics;
+    using System.Runtime.InteropServices;
+
+    /// <summary>
+    /// Runs segmentation at a reduced resolution and upsamples the predicted mask to the full frame resolution.
+    /// Upsampling uses a fast guided filter with the full resolution luma as guide, so that mask edges
+    /// snap to edges in the frame instead of being blurred by interpolation.
+    /// </summary>
+    internal sealed class GuidedMaskUpsampler {
+
+        #region --Client API--
+        /// <summary>
+        /// Full resolution frame width.
+        /// </summary>
+        public readonly int width;
+
+        /// <summary>
+        /// Full resolution frame height.
+        /// </summary>
+        public readonly int height;
+
+        /// <summary>
+        /// Maximum inference resolution.
+        /// </summary>
+        public readonly int resolution;
+
+        /// <summary>
+        /// Inference image width.
+        /// </summary>
+        public readonly int inputWidth;
+
+        /// <summary>
+        /// Inference image height.
+        /// </summary>
+        public readonly int inputHeight;
+
+        /// <summary>
+        /// Create a guided mask upsampler.
+        /// </summary>
+        /// <param name="width">Full resolution frame width.</param>
+        /// <param name="height">Full resolution frame height.</param>
+        /// <param name="resolution">Maximum inference resolution.</param>
+        public GuidedMaskUpsampler(int width, int height, int resolution) {
+            var scale = Math.Min(1f, (float)resolution / Math.Max(width, height));
+            this.width = width;
+            this.height = height;
+            this.resolution = resolution;
+            this.inputWidth = Math.Max((int)(width * scale), 1);
+            this.inputHeight = Math.Max((int)(height * scale), 1);
+            this.radius = Math.Max(Math.Max(inputWidth, inputHeight) / 64, 1);
+            this.input = new byte[inputWidth * inputHeight * 4];
+            this.guide = new float[inputWidth * inputHeight];
+            this.mask = new float[inputWidth * inputHeight];
+            this.meanGuide = new float[inputWidth * inputHeight];
+            this.meanMask = new float[inputWidth * inputHeight];
+            this.correlation = new float[inputWidth * inputHeight];
+            this.variance = new float[inputWidth * inputHeight];
+            this.column = new float[inputHeight];
+            this.scratch = new float[Math.Max(inputWidth, inputHeight)];
+            this.inputA = new float[inputWidth];
+            this.inputB = new float[inputWidth];
+            this.rowA = new float[width];
+            this.rowB = new float[width];
+            this.rowLuma = new float[width];
+            this.x0 = new int[width];
+            this.x1 = new int[width];
+            this.wx = new float[width];
+            for (var x = 0; x < width; ++x) {
+                var sx = Math.Clamp((x + 0.5f) * inputWidth / width - 0.5f, 0f, inputWidth - 1);
+                x0[x] = (int)sx;
+                x1[x] = Math.Min(x0[x] + 1, inputWidth - 1);
+                wx[x] = sx - x0[x];
+            }
+        }
+
+        /// <summary>
+        /// Downsample an RGBA8888 frame to the inference resolution.
+        /// </summary>
+        /// <param name="data">RGBA8888 pixel data.</param>
+        /// <param name="rowStride">Frame row stride in bytes.</param>
+        /// <returns>RGBA8888 inference image with size `(inputWidth, inputHeight)`. This buffer is reused.</returns>
+        public byte[] Downsample(ReadOnlySpan<byte> data, int rowStride) {
+            for (var j = 0; j < inputHeight; ++j) {
+                var (top, bottom) = (j * height / inputHeight, Math.Max((j + 1) * height / inputHeight, j * height / inputHeight + 1));
+                for (var i = 0; i < inputWidth; ++i) {
+                    // Average the source block
+                    var (left, right) = (i * width / inputWidth, Math.Max((i + 1) * width / inputWidth, i * width / inputWidth + 1));
+                    int r = 0, g = 0, b = 0, a = 0;
+                    for (var y = top; y < bottom; ++y) {
+                        var row = data.Slice(y * rowStride);
+                        for (var x = left; x < right; ++x) {
+                            r += row[4 * x];
+                            g += row[4 * x + 1];
+                            b += row[4 * x + 2];
+                            a += row[4 * x + 3];
+                        }
+                    }
+                    var count = (bottom - top) * (right - left);
+                    var offset = 4 * (j * inputWidth + i);
+                    input[offset] = (byte)(r / count);
+                    input[offset + 1] = (byte)(g / count);
+                    input[offset + 2] = (byte)(b / count);
+                    input[offset + 3] = (byte)(a / count);
+                    guide[j * inputWidth + i] = Luma(input[offset], input[offset + 1], input[offset + 2]);
+                }
+            }
+            return input;
+        }
+
+        /// <summary>
+        /// Upsample a predicted mask and composite it as the alpha channel of the full resolution frame.
+        /// </summary>
+        /// <param name="prediction">Predicted image. The mask is read from the alpha channel, or the first channel of single channel images.</param>
+        /// <param name="predictionWidth">Predicted image width.</param>
+        /// <param name="predictionHeight">Predicted image height.</param>
+        /// <param name="predictionChannels">Predicted image channels.</param>
+        /// <param name="data">Full resolution RGBA8888 pixel data, used as the guide.</param>
+        /// <param name="rowStride">Full resolution row stride in bytes.</param>
+        /// <param name="destination">Destination RGBA8888 pixel data with size `(width, height)`.</param>
+        public void Upsample(
+            ReadOnlySpan<byte> prediction,
+            int predictionWidth,
+            int predictionHeight,
+            int predictionChannels,
+            ReadOnlySpan<byte> data,
+            int rowStride,
+            Span<byte> destination
+        ) {
+            // Extract mask at the inference resolution
+            var channel = predictionChannels == 4 ? 3 : 0;
+            for (var j = 0; j < inputHeight; ++j)
+                for (var i = 0; i < inputWidth; ++i) {
+                    var x = i * predictionWidth / inputWidth;
+                    var y = j * predictionHeight / inputHeight;
+                    mask[j * inputWidth + i] = prediction[(y * predictionWidth + x) * predictionChannels + channel] / 255f;
+                }
+            // Compute guided filter coefficients at the inference resolution, such that `mask = a * guide + b`
+            var length = mask.Length;
+            for (var i = 0; i < length; ++i) {
+                correlation[i] = guide[i] * mask[i];
+                variance[i] = guide[i] * guide[i];
+            }
+            BoxFilter(guide, meanGuide);
+            BoxFilter(mask, meanMask);
+            BoxFilter(correlation, correlation);
+            BoxFilter(variance, variance);
+            var a = correlation;
+            var b = variance;
+            for (var i = 0; i < length; ++i) {
+                var covariance = correlation[i] - meanGuide[i] * meanMask[i];
+                var guideVariance = variance[i] - meanGuide[i] * meanGuide[i];
+                a[i] = covariance / (guideVariance + Epsilon);
+                b[i] = meanMask[i] - a[i] * meanGuide[i];
+            }
+            BoxFilter(a, a);
+            BoxFilter(b, b);
+            // Upsample coefficients and apply them to the full resolution guide
+            var vectorSize = Vector<float>.Count;
+            for (var y = 0; y < height; ++y) {
+                var sy = Math.Clamp((y + 0.5f) * inputHeight / height - 0.5f, 0f, inputHeight - 1);
+                var y0 = (int)sy;
+                var y1 = Math.Min(y0 + 1, inputHeight - 1);
+                var wy = sy - y0;
+                Lerp(a.AsSpan(y0 * inputWidth, inputWidth), a.AsSpan(y1 * inputWidth, inputWidth), wy, inputA);
+                Lerp(b.AsSpan(y0 * inputWidth, inputWidth), b.AsSpan(y1 * inputWidth, inputWidth), wy, inputB);
+                var source = data.Slice(y * rowStride, 4 * width);
+                var output = destination.Slice(y * 4 * width, 4 * width);
+                for (var x = 0; x < width; ++x) {
+                    var (i0, i1, w) = (x0[x], x1[x], wx[x]);
+                    rowA[x] = inputA[i0] + w * (inputA[i1] - inputA[i0]);
+                    rowB[x] = inputB[i0] + w * (inputB[i1] - inputB[i0]);
+                    rowLuma[x] = Luma(source[4 * x], source[4 * x + 1], source[4 * x + 2]);
+                }
+                var i = 0;
+                for (; i + vectorSize <= width; i += vectorSize) {
+                    var alpha = new Vector<float>(rowA, i) * new Vector<float>(rowLuma, i) + new Vector<float>(rowB, i);
+                    Vector.Min(Vector.Max(alpha, Vector<float>.Zero), Vector<float>.One).CopyTo(rowA, i);
+                }
+                for (; i < width; ++i)
+                    rowA[i] = Math.Clamp(rowA[i] * rowLuma[i] + rowB[i], 0f, 1f);
+                // Composite
+                source.CopyTo(output);
+                for (var x = 0; x < width; ++x)
+                    output[4 * x + 3] = (byte)(rowA[x] * 255f + 0.5f);
+            }
+        }
+        #endregion
+
+
+        #region --Operations--
+        private readonly int radius;
+        private readonly byte[] input;
+        private readonly float[] guide;
+        private readonly float[] mask;
+        private readonly float[] meanGuide;
+        private readonly float[] meanMask;
+        private readonly float[] correlation;
+        private readonly float[] variance;
+        private readonly float[] column;
+        private readonly float[] scratch;
+        private readonly float[] inputA;
+        private readonly float[] inputB;
+        private readonly float[] rowA;
+        private readonly float[] rowB;
+        private readonly float[] rowLuma;
+        private readonly int[] x0;
+        private readonly int[] x1;
+        private readonly float[] wx;
+        private const float Epsilon = 1e-3f;
+
+        private void BoxFilter(float[] source, float[] destination) {
+            // Filter rows
+            for (var y = 0; y < inputHeight; ++y) {
+                var row = source.AsSpan(y * inputWidth, inputWidth);
+                BoxFilter(row, scratch.AsSpan(0, inputWidth));
+                scratch.AsSpan(0, inputWidth).CopyTo(destination.AsSpan(y * inputWidth, inputWidth));
+            }
+            // Filter columns
+            for (var x = 0; x < inputWidth; ++x) {
+                for (var y = 0; y < inputHeight; ++y)
+                    column[y] = destination[y * inputWidth + x];
+                BoxFilter(column, scratch.AsSpan(0, inputHeight));
+                for (var y = 0; y < inputHeight; ++y)
+                    destination[y * inputWidth + x] = scratch[y];
+            }
+        }
+
+        private void BoxFilter(ReadOnlySpan<float> source, Span<float> destination) {
+            var sum = 0f;
+            var (start, end) = (0, Math.Min(radius, source.Length - 1));
+            for (var i = start; i <= end; ++i)
+                sum += source[i];
+            for (var i = 0; i < source.Length; ++i) {
+                destination[i] = sum / (end - start + 1);
+                if (i + radius + 1 < source.Length)
+                    sum += source[++end];
+                if (i - radius >= 0)
+                    sum -= source[start++];
+            }
+        }
+
+        private static void Lerp(ReadOnlySpan<float> a, ReadOnlySpan<float> b, float t, Span<float> destination) {
+            var vectorsA = MemoryMarshal.Cast<float, Vector<float>>(a);
+            var vectorsB = MemoryMarshal.Cast<float, Vector<float>>(b);
+            var vectorsDestination = MemoryMarshal.Cast<float, Vector<float>>(destination);
+            for (var i = 0; i < vectorsA.Length; ++i)
+                vectorsDestination[i] = vectorsA[i] + (vectorsB[i] - vectorsA[i]) * t;
+            for (var i = vectorsA.Length * Vector<float>.Count; i < a.Length; ++i)
+                destination[i] = a[i] + (b[i] - a[i]) * t;
+        }
+
+        private static float Luma(byte r, byte g, byte b) => (0.299f * r + 0.587f * g + 0.114f * b) / 255f;
+        #endregion
+    }
+}
\ No newline at end of file
@@ -0,0 +1,1460 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+#nullable enable
+
+namespace VideoKit.Internal {
+
+    using System;
+    using System.Buffers;
+    using System.Buffers.Binary;
+    using System.Collections.Generic;
+    using System.IO;
+    using System.Linq;
+
+    /// <summary>
+    /// Managed utilities for reading, editing, and writing ISO base media files (MP4, MOV).
+    /// Samples are always stream-copied, so none of these operations decode or encode media.
+    /// </summary>
+    internal static class MP4Container {
+
+        #region --Types--
+        /// <summary>
+        /// Movie parsed from an ISO base media file.
+        /// </summary>
+        public sealed class Movie {
+
+            /// <summary>
+            /// File type box payload.
+            /// </summary>
+            public byte[] fileType = DefaultFileType;
+
+            /// <summary>
+            /// Movie header box payload.
+            /// </summary>
+            public byte[] header = Array.Empty<byte>();
+
+            /// <summary>
+            /// Movie tracks.
+            /// </summary>
+            public readonly List<Track> tracks = new();
+
+            /// <summary>
+            /// Movie timescale.
+            /// </summary>
+            public uint timescale => BinaryPrimitives.ReadUInt32BigEndian(header.AsSpan(header[0] == 1 ? 20 : 12));
+
+            /// <summary>
+            /// Get the first track with a given handler type.
+            /// </summary>
+            /// <param name="handler">Track handler type.</param>
+            /// <returns>Track or `null` if the movie has no such track.</returns>
+            public Track? GetTrack(string handler) => tracks.FirstOrDefault(track => track.handler == handler);
+        }
+
+        /// <summary>
+        /// Movie track.
+        /// </summary>
+        public sealed class Track {
+
+            /// <summary>
+            /// Track handler type, like `vide` or `soun`.
+            /// </summary>
+            public string handler = string.Empty;
+
+            /// <summary>
+            /// Track header box payload.
+            /// </summary>
+            public byte[] header = Array.Empty<byte>();
+
+            /// <summary>
+            /// Media header box payload.
+            /// </summary>
+            public byte[] mediaHeader = Array.Empty<byte>();
+
+            /// <summary>
+            /// Handler reference box payload.
+            /// </summary>
+            public byte[] handlerReference = Array.Empty<byte>();
+
+            /// <summary>
+            /// Media information boxes besides the sample table, like `vmhd` and `dinf`.
+            /// </summary>
+            public readonly List<byte[]> mediaInformation = new();
+
+            /// <summary>
+            /// Sample description entries.
+            /// </summary>
+            public readonly List<byte[]> sampleDescriptions = new();
+
+            /// <summary>
+            /// Track samples in decode order.
+            /// </summary>
+            public readonly List<Sample> samples = new();
+
+            /// <summary>
+            /// User data boxes, like `ludt`.
+            /// </summary>
+            public readonly List<byte[]> userData = new();
+
+            /// <summary>
+            /// Media time where presentation starts, from the track edit list.
+            /// </summary>
+            public long mediaTime;
+
+            /// <summary>
+            /// Track identifier.
+            /// </summary>
+            public uint id => BinaryPrimitives.ReadUInt32BigEndian(header.AsSpan(header[0] == 1 ? 20 : 12));
+
+            /// <summary>
+            /// Media timescale.
+            /// </summary>
+            public uint timescale => BinaryPrimitives.ReadUInt32BigEndian(mediaHeader.AsSpan(mediaHeader[0] == 1 ? 20 : 12));
+
+            /// <summary>
+            /// Track duration in media timescale.
+            /// </summary>
+            public long duration => samples.Sum(sample => (long)sample.duration);
+
+            /// <summary>
+            /// Create a track with the same headers and sample descriptions as another track but no samples.
+            /// </summary>
+            /// <param name="track">Track to copy.</param>
+            /// <returns>Empty track.</returns>
+            public static Track CreateEmpty(Track track) {
+                var result = new Track {
+                    handler = track.handler,
+                    header = track.header,
+                    mediaHeader = track.mediaHeader,
+                    handlerReference = track.handlerReference,
+                    mediaTime = track.mediaTime,
+                };
+                result.mediaInformation.AddRange(track.mediaInformation);
+                result.sampleDescriptions.AddRange(track.sampleDescriptions);
+                return result;
+            }
+        }
+
+        /// <summary>
+        /// Track sample.
+        /// </summary>
+        public struct Sample {
+
+            /// <summary>
+            /// Path to the file containing the sample data.
+            /// </summary>
+            public string? path;
+
+            /// <summary>
+            /// In-memory sample data, used instead of the `path` when set.
+            /// </summary>
+            public byte[]? data;
+
+            /// <summary>
+            /// Sample data offset in the file.
+            /// </summary>
+            public long offset;
+
+            /// <summary>
+            /// Sample data size in bytes, including the `prefix`.
+            /// </summary>
+            public int size;
+
+            /// <summary>
+            /// Bytes written before the sample data, like in-band parameter sets.
+            /// </summary>
+            public byte[]? prefix;
+
+            /// <summary>
+            /// Sample duration in media timescale.
+            /// </summary>
+            public uint duration;
+
+            /// <summary>
+            /// Composition time offset in media timescale.
+            /// </summary>
+            public int compositionOffset;
+
+            /// <summary>
+            /// Whether the sample is a sync sample (keyframe).
+            /// </summary>
+            public bool sync;
+
+            /// <summary>
+            /// Zero-based index of the sample description used by this sample.
+            /// </summary>
+            public int description;
+        }
+        #endregion
+
+
+        #region --Client API--
+        /// <summary>
+        /// Check whether a recording format is written to an ISO base media file.
+        /// </summary>
+        /// <param name="format">Recording format.</param>
+        /// <returns>Whether the format writes an MP4 or MOV file.</returns>
+        public static bool IsSupported(MediaRecorder.Format format) => format switch {
+            MediaRecorder.Format.MP4        => true,
+            MediaRecorder.Format.HEVC       => true,
+            MediaRecorder.Format.AV1        => true,
+            MediaRecorder.Format.ProRes4444 => true,
+            _                               => false,
+        };
+
+        /// <summary>
+        /// Read the movie structure of an MP4 or MOV file.
+        /// Sample data is not read.
+        /// </summary>
+        /// <param name="path">MP4 or MOV file path.</param>
+        /// <returns>Movie.</returns>
+        public static Movie Read(string path) {
+            using var stream = new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.Read);
+            var movie = new Movie();
+            var ftyp = FindBox(stream, 0L, stream.Length, @"ftyp");
+            var moov = FindBox(stream, 0L, stream.Length, @"moov") ?? throw new InvalidDataException($"Cannot read movie because file is not a valid MP4 file: {path}");
+            if (ftyp != null)
+                movie.fileType = ReadPayload(stream, ftyp.Value);
+            for (var box = ReadBox(stream, moov.dataOffset, moov.end); box != null; box = ReadBox(stream, box.Value.end, moov.end))
+                if (box.Value.type == @"mvhd")
+                    movie.header = ReadPayload(stream, box.Value);
+                else if (box.Value.type == @"trak")
+                    movie.tracks.Add(ReadTrack(stream, box.Value, path));
+            return movie;
+        }
+
+        /// <summary>
+        /// Write a movie to an MP4 or MOV file.
+        /// Samples are copied from their source files in interleaved chunks.
+        /// </summary>
+        /// <param name="movie">Movie to write.</param>
+        /// <param name="path">Output file path.</param>
+        public static void Write(Movie movie, string path) {
+            var sources = new Dictionary<string, FileStream>();
+            try {
+                using var stream = new FileStream(path, FileMode.Create, FileAccess.ReadWrite, FileShare.None, 1 << 16);
+                // Write file type
+                WriteBox(stream, @"ftyp", movie.fileType);
+                // Write media data
+                var mdatOffset = stream.Position;
+                stream.Write(new byte[16], 0, 16);
+                var chunks = WriteSamples(movie, stream, sources);
+                var mdatEnd = stream.Position;
+                // Write media data header
+                var header = new byte[16];
+                var mdatSize = mdatEnd - mdatOffset - 8;
+                if (mdatSize <= uint.MaxValue) {
+                    BinaryPrimitives.WriteUInt32BigEndian(header, 8);
+                    WriteFourCC(header.AsSpan(4), @"free");
+                    BinaryPrimitives.WriteUInt32BigEndian(header.AsSpan(8), (uint)mdatSize);
+                    WriteFourCC(header.AsSpan(12), @"mdat");
+                } else {
+                    BinaryPrimitives.WriteUInt32BigEndian(header, 1);
+                    WriteFourCC(header.AsSpan(4), @"mdat");
+                    BinaryPrimitives.WriteUInt64BigEndian(header.AsSpan(8), (ulong)(mdatSize + 8));
+                }
+                stream.Position = mdatOffset;
+                stream.Write(header, 0, header.Length);
+                stream.Position = mdatEnd;
+                // Write movie
+                WriteBox(stream, @"moov", CreateMovieBox(movie, chunks));
+            } finally {
+                foreach (var source in sources.Values)
+                    source.Dispose();
+            }
+        }
+
+        /// <summary>
+        /// Concatenate movies with matching tracks into a single movie.
+        /// Sample descriptions which differ between movies are kept as separate entries,
+        /// so movies with different resolutions or codec parameters can be concatenated.
+        /// Movies may lack some tracks, like video-only segments of a recording whose audio is in the first segment.
+        /// </summary>
+        /// <param name="movies">Movies to concatenate.</param>
+        /// <param name="startTimes">Optional video start time of each movie in seconds, used to preserve gaps between movies.</param>
+        /// <returns>Concatenated movie.</returns>
+        public static Movie Concatenate(
+            IReadOnlyList<Movie> movies,
+            IReadOnlyList<double>? startTimes = null
+        ) {
+            // Check
+            if (movies.Count == 0)
+                throw new ArgumentException(@"Cannot concatenate movies because no movies were provided", nameof(movies));
+            // Create result
+            var first = movies[0];
+            var result = new Movie { fileType = first.fileType, header = first.header };
+            foreach (var movie in movies)
+                for (var j = 0; j < movie.tracks.Count; ++j) {
+                    var track = movie.tracks[j];
+                    var ordinal = movie.tracks.Take(j).Count(t => t.handler == track.handler);
+                    if (result.tracks.Count(t => t.handler == track.handler) <= ordinal)
+                        result.tracks.Add(Track.CreateEmpty(track));
+                }
+            // Append tracks
+            for (var i = 0; i < movies.Count; ++i)
+                for (var j = 0; j < result.tracks.Count; ++j) {
+                    var track = result.tracks[j];
+                    var ordinal = result.tracks.Take(j).Count(t => t.handler == track.handler);
+                    var source = movies[i].tracks.Where(t => t.handler == track.handler).ElementAtOrDefault(ordinal);
+                    if (source == null)
+                        continue;
+                    // Fill gap before video samples
+                    var startTime = startTimes != null && track.handler == @"vide" ? (long)(startTimes[i] * track.timescale) : 0L;
+                    var gap = startTime - track.duration;
+                    if (gap > 0 && track.samples.Count > 0) {
+                        var last = track.samples[track.samples.Count - 1];
+                        last.duration += (uint)Math.Min(gap, uint.MaxValue - last.duration);
+                        track.samples[track.samples.Count - 1] = last;
+                    }
+                    AppendSamples(source, track);
+                }
+            // Return
+            return result;
+        }
+
+        /// <summary>
+        /// Append samples from one track to another, rescaling timing and merging sample descriptions.
+        /// </summary>
+        /// <param name="source">Source track.</param>
+        /// <param name="destination">Destination track.</param>
+        /// <param name="startIndex">Index of the first source sample to append.</param>
+        /// <param name="count">Number of source samples to append.</param>
+        public static void AppendSamples(
+            Track source,
+            Track destination,
+            int startIndex = 0,
+            int count = -1
+        ) {
+            // Map sample descriptions
+            var descriptions = new int[source.sampleDescriptions.Count];
+            for (var i = 0; i < descriptions.Length; ++i) {
+                var description = source.sampleDescriptions[i];
+                var index = destination.sampleDescriptions.FindIndex(d => d.AsSpan().SequenceEqual(description));
+                if (index < 0) {
+                    index = destination.sampleDescriptions.Count;
+                    destination.sampleDescriptions.Add(description);
+                }
+                descriptions[i] = index;
+            }
+            // Append
+            var sourceTimescale = source.timescale;
+            var destinationTimescale = destination.timescale;
+            count = count < 0 ? source.samples.Count - startIndex : count;
+            for (var i = startIndex; i < startIndex + count; ++i) {
+                var sample = source.samples[i];
+                sample.description = descriptions[sample.description];
+                if (sourceTimescale != destinationTimescale) {
+                    sample.duration = (uint)Rescale(sample.duration, sourceTimescale, destinationTimescale);
+                    sample.compositionOffset = (int)Rescale(sample.compositionOffset, sourceTimescale, destinationTimescale);
+                }
+                destination.samples.Add(sample);
+            }
+        }
+
+        /// <summary>
+        /// Check whether a track is encoded with the video codec of a recording format.
+        /// </summary>
+        /// <param name="track">Track.</param>
+        /// <param name="format">Recording format.</param>
+        /// <returns>Whether all sample descriptions of the track use the codec of the format.</returns>
+        public static bool HasCodec(Track track, MediaRecorder.Format format) {
+            var codecs = format switch {
+                MediaRecorder.Format.MP4        => new[] { @"avc1", @"avc3" },
+                MediaRecorder.Format.HEVC       => new[] { @"hvc1", @"hev1" },
+                MediaRecorder.Format.AV1        => new[] { @"av01" },
+                MediaRecorder.Format.ProRes4444 => new[] { @"ap4h" },
+                _                               => Array.Empty<string>(),
+            };
+            return
+                track.sampleDescriptions.Count > 0 &&
+                track.sampleDescriptions.All(description => codecs.Contains(GetFourCC(description.AsSpan(4))));
+        }
+
+        /// <summary>
+        /// Merge the H.264 or HEVC sample descriptions of a video track into a single entry with in-band parameter sets.
+        /// Many players only apply the first sample description of a track, so samples which were encoded with other
+        /// parameter sets, like re-encoded segments spliced between stream-copied samples, would be decoded incorrectly.
+        /// The merged entry is an `avc3` or `hev1` entry, and the parameter sets of each sample are prepended to every sync sample.
+        /// </summary>
+        /// <param name="track">Video track.</param>
+        /// <returns>Whether the sample descriptions were merged. Tracks with a single sample description or other codecs are left unchanged.</returns>
+        public static bool InlineParameterSets(Track track) {
+            // Check
+            if (track.sampleDescriptions.Count < 2)
+                return false;
+            var codecs = track.sampleDescriptions.Select(description => GetFourCC(description.AsSpan(4))).ToArray();
+            var hevc = codecs.All(codec => codec == @"hvc1" || codec == @"hev1");
+            if (!hevc && !codecs.All(codec => codec == @"avc1" || codec == @"avc3"))
+                return false;
+            // Read parameter sets
+            var prefixes = new byte[track.sampleDescriptions.Count][];
+            var lengthSizes = new int[prefixes.Length];
+            for (var i = 0; i < prefixes.Length; ++i) {
+                var prefix = GetParameterSets(track.sampleDescriptions[i], hevc, out lengthSizes[i]);
+                if (prefix == null)
+                    return false;
+                prefixes[i] = prefix;
+            }
+            if (lengthSizes.Distinct().Count() != 1)
+                return false;
+            // Merge
+            var entry = (byte[])track.sampleDescriptions[0].Clone();
+            WriteFourCC(entry.AsSpan(4), hevc ? @"hev1" : @"avc3");
+            track.sampleDescriptions.Clear();
+            track.sampleDescriptions.Add(entry);
+            for (var i = 0; i < track.samples.Count; ++i) {
+                var sample = track.samples[i];
+                if (sample.sync && sample.prefix == null) {
+                    sample.prefix = prefixes[sample.description];
+                    sample.size += sample.prefix.Length;
+                }
+                sample.description = 0;
+                track.samples[i] = sample;
+            }
+            return true;
+        }
+
+        /// <summary>
+        /// Create a time-lapse of a video track by keeping only sync samples and re-timing them.
+        /// Sync samples are decodable on their own, so the result can be written without re-encoding.
+        /// </summary>
+        /// <param name="track">Video track.</param>
+        /// <param name="speed">Speed factor.</param>
+        /// <param name="maxFrameDuration">Maximum output frame duration in seconds.</param>
+        /// <returns>Time-lapse track, or `null` if sync samples are too sparse for the output frame duration.</returns>
+        public static Track? CreateTimeLapse(Track track, double speed, double maxFrameDuration) {
+            // Check
+            if (track.samples.Count == 0)
+                return null;
+            // Select sync samples, at most one per source frame duration of output
+            var step = speed * track.duration / track.samples.Count;
+            var selected = new List<(int index, long time)>();
+            var time = 0L;
+            for (var i = 0; i < track.samples.Count; time += track.samples[i++].duration)
+                if (track.samples[i].sync && (selected.Count == 0 || time - selected[selected.Count - 1].time >= step))
+                    selected.Add((i, time));
+            selected.Add((-1, time));
+            // Check that the result plays smoothly enough
+            var maxDuration = maxFrameDuration * track.timescale * speed;
+            for (var i = 1; i < selected.Count; ++i)
+                if (selected[i].time - selected[i - 1].time > maxDuration)
+                    return null;
+            // Re-time
+            var result = Track.CreateEmpty(track);
+            result.mediaTime = 0L;
+            for (var i = 0; i + 1 < selected.Count; ++i) {
+                var sample = track.samples[selected[i].index];
+                var start = (long)Math.Round(selected[i].time / speed);
+                var end = (long)Math.Round(selected[i + 1].time / speed);
+                sample.duration = (uint)Math.Max(end - start, 1L);
+                sample.compositionOffset = 0;
+                result.samples.Add(sample);
+            }
+            return result;
+        }
+
+        /// <summary>
+        /// Create a track with only the sync samples of a video track, each lasting until the next sync sample.
+        /// Sync samples are decodable on their own, so the result can be written without re-encoding,
+        /// and decoding it yields the keyframes of the source at their original times.
+        /// </summary>
+        /// <param name="track">Video track.</param>
+        /// <returns>Keyframe track, or `null` if the track does not start with a sync sample.</returns>
+        public static Track? CreateKeyframeTrack(Track track) {
+            // Check
+            if (track.samples.Count == 0 || !track.samples[0].sync)
+                return null;
+            // Select sync samples
+            var selected = new List<(int index, long time)>();
+            var time = 0L;
+            for (var i = 0; i < track.samples.Count; time += track.samples[i++].duration)
+                if (track.samples[i].sync)
+                    selected.Add((i, time));
+            selected.Add((-1, time));
+            // Re-time
+            var result = Track.CreateEmpty(track);
+            result.mediaTime = 0L;
+            for (var i = 0; i + 1 < selected.Count; ++i) {
+                var sample = track.samples[selected[i].index];
+                sample.duration = (uint)Math.Max(selected[i + 1].time - selected[i].time, 1L);
+                sample.compositionOffset = 0;
+                result.samples.Add(sample);
+            }
+            return result;
+        }
+
+        /// <summary>
+        /// Add a track to an MP4 or MOV file in place.
+        /// The track samples are appended to the file and the track box is inserted into the existing movie box,
+        /// so existing sample data and boxes are not rewritten.
+        /// </summary>
+        /// <param name="path">MP4 or MOV file path.</param>
+        /// <param name="track">Track to add.</param>
+        public static void AddTrack(string path, Track track) {
+            var sources = new Dictionary<string, FileStream>();
+            try {
+                using var stream = new FileStream(path, FileMode.Open, FileAccess.ReadWrite, FileShare.None, 1 << 16);
+                // Write track samples
+                var mdatOffset = stream.Length;
+                var header = new byte[8];
+                stream.Position = mdatOffset;
+                stream.Write(header, 0, header.Length);
+                var trackMovie = new Movie();
+                trackMovie.tracks.Add(track);
+                var chunks = WriteSamples(trackMovie, stream, sources)[0];
+                BinaryPrimitives.WriteUInt32BigEndian(header, (uint)(stream.Position - mdatOffset));
+                WriteFourCC(header.AsSpan(4), @"mdat");
+                var mdatEnd = stream.Position;
+                stream.Position = mdatOffset;
+                stream.Write(header, 0, header.Length);
+                // Insert track box
+                UpdateMovieBox(stream, moov => {
+                    var children = SplitBox(moov, out var moovHeader);
+                    var mvhd = children.Find(child => GetFourCC(child.AsSpan(4)) == @"mvhd") ?? throw new InvalidDataException($"Cannot add track because movie has no movie header: {path}");
+                    var v1 = mvhd[8] == 1;
+                    var timescale = BinaryPrimitives.ReadUInt32BigEndian(mvhd.AsSpan(v1 ? 28 : 20));
+                    var duration = Rescale(track.duration, track.timescale, timescale);
+                    var movieDuration = v1 ?
+                        BinaryPrimitives.ReadInt64BigEndian(mvhd.AsSpan(32)) :
+                        BinaryPrimitives.ReadUInt32BigEndian(mvhd.AsSpan(24));
+                    if (duration > movieDuration)
+                        WriteDuration(mvhd, v1 ? 32 : 24, v1, duration);
+                    var nextTrackId = BinaryPrimitives.ReadUInt32BigEndian(mvhd.AsSpan(v1 ? 116 : 104));
+                    BinaryPrimitives.WriteUInt32BigEndian(mvhd.AsSpan(v1 ? 116 : 104), Math.Max(nextTrackId, track.id + 1));
+                    children.Add(CreateBox(@"trak", CreateTrackBox(track, chunks, duration)));
+                    return JoinBox(moovHeader, children);
+                });
+            } finally {
+                foreach (var source in sources.Values)
+                    source.Dispose();
+            }
+        }
+
+        /// <summary>
+        /// Create a timed metadata track.
+        /// Each metadata sample becomes a sample which lasts until the next one.
+        /// </summary>
+        /// <param name="id">Track identifier.</param>
+        /// <param name="path">Path to the file containing the metadata payloads.</param>
+        /// <param name="buffers">Metadata timestamps in nanoseconds with their payload offsets and sizes in the file, in timestamp order.</param>
+        /// <param name="startTimestamp">Timestamp corresponding to the start of the movie, in nanoseconds.</param>
+        /// <returns>Metadata track.</returns>
+        public static Track CreateMetadataTrack(
+            uint id,
+            string path,
+            IReadOnlyList<(long timestamp, long offset, int size)> buffers,
+            long startTimestamp
+        ) {
+            // Create headers
+            var track = new Track {
+                handler = @"meta",
+                header = new byte[84],
+                mediaHeader = new byte[24],
+                handlerReference = new byte[25 + MetadataHandlerName.Length],
+            };
+            BinaryPrimitives.WriteUInt32BigEndian(track.header, 0x000003); // enabled, in movie
+            BinaryPrimitives.WriteUInt32BigEndian(track.header.AsSpan(12), id);
+            IdentityMatrix.CopyTo(track.header, 40);
+            BinaryPrimitives.WriteUInt32BigEndian(track.mediaHeader.AsSpan(12), MetadataTimescale);
+            BinaryPrimitives.WriteUInt16BigEndian(track.mediaHeader.AsSpan(20), 0x55C4); // 'und'
+            WriteFourCC(track.handlerReference.AsSpan(8), @"meta");
+            for (var i = 0; i < MetadataHandlerName.Length; ++i)
+                track.handlerReference[24 + i] = (byte)MetadataHandlerName[i];
+            track.mediaInformation.Add(CreateBox(@"nmhd", new byte[4]));
+            track.mediaInformation.Add(CreateBox(@"dinf", CreateBox(@"dref", new byte[] { 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 12, (byte)'u', (byte)'r', (byte)'l', (byte)' ', 0, 0, 0, 1 })));
+            var description = new byte[8 + 1 + MetadataMimeType.Length + 1];
+            BinaryPrimitives.WriteUInt16BigEndian(description.AsSpan(6), 1); // data reference index
+            for (var i = 0; i < MetadataMimeType.Length; ++i)
+                description[9 + i] = (byte)MetadataMimeType[i];
+            track.sampleDescriptions.Add(CreateBox(@"mett", description));
+            // Create samples
+            var time = 0L;
+            for (var i = 0; i < buffers.Count; ++i) {
+                var sampleTime = Math.Max(Rescale(buffers[i].timestamp - startTimestamp, 1_000_000_000, MetadataTimescale), time);
+                var nextTime = i + 1 < buffers.Count ?
+                    Math.Max(Rescale(buffers[i + 1].timestamp - startTimestamp, 1_000_000_000, MetadataTimescale), sampleTime) :
+                    sampleTime + 1;
+                if (sampleTime > time) // pad with an empty sample
+                    track.samples.Add(new Sample { data = Array.Empty<byte>(), duration = (uint)(sampleTime - time), sync = true });
+                track.samples.Add(new Sample {
+                    path = path,
+                    offset = buffers[i].offset,
+                    size = buffers[i].size,
+                    duration = (uint)(nextTime - sampleTime),
+                    sync = true
+                });
+                time = nextTime;
+            }
+            // Return
+            return track;
+        }
+
+        /// <summary>
+        /// Read the timed metadata track of an MP4 or MOV file.
+        /// </summary>
+        /// <param name="path">MP4 or MOV file path.</param>
+        /// <returns>Metadata buffers.</returns>
+        public static IEnumerable<MetadataBuffer> ReadMetadata(string path) {
+            var movie = TryRead(path);
+            var track = movie?.tracks.FirstOrDefault(t => t.handler == @"meta" && t.sampleDescriptions.Any(d => GetFourCC(d.AsSpan(4)) == @"mett"));
+            if (track == null)
+                yield break;
+            using var stream = new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.Read);
+            var timescale = track.timescale;
+            var time = 0L;
+            foreach (var sample in track.samples) {
+                if (sample.size > 0) {
+                    var data = new byte[sample.size];
+                    stream.Position = sample.offset;
+                    ReadExactly(stream, data);
+                    yield return new MetadataBuffer(data, Rescale(time + sample.compositionOffset, timescale, 1_000_000_000));
+                }
+                time += sample.duration;
+            }
+        }
+
+        /// <summary>
+        /// Write loudness metadata into the audio track of an MP4 or MOV file in place.
+        /// The loudness is written as an ISO/IEC 14496-12 `ludt` box, so players can normalize playback without decoding.
+        /// Nothing is written if the file has no audio track.
+        /// </summary>
+        /// <param name="path">MP4 or MOV file path.</param>
+        /// <param name="integratedLoudness">Integrated program loudness in LUFS.</param>
+        /// <param name="truePeak">True peak in dBTP.</param>
+        /// <param name="samplePeak">Sample peak in dBFS.</param>
+        public static void SetLoudness(
+            string path,
+            float integratedLoudness,
+            float truePeak,
+            float samplePeak
+        ) {
+            // Create loudness box
+            var tlou = new byte[4 + 2 + 3 + 1 + 1 + 3];
+            var bsSamplePeak = EncodePeakLevel(samplePeak);
+            var bsTruePeak = EncodePeakLevel(truePeak);
+            tlou[6] = (byte)(bsSamplePeak >> 4);
+            tlou[7] = (byte)((bsSamplePeak << 4) | (bsTruePeak >> 8));
+            tlou[8] = (byte)bsTruePeak;
+            tlou[9] = 0x23;     // ITU-R BS.1770-4, measured
+            tlou[10] = 1;       // measurement count
+            tlou[11] = 1;       // program loudness
+            tlou[12] = (byte)Math.Clamp(MathF.Round((integratedLoudness + 57.75f) * 4f), 0f, 255f);
+            tlou[13] = 0x13;    // EBU R128, measured
+            var ludt = CreateBox(@"ludt", CreateBox(@"tlou", tlou));
+            // Insert into the user data of the audio track
+            using var stream = new FileStream(path, FileMode.Open, FileAccess.ReadWrite, FileShare.None, 1 << 16);
+            UpdateMovieBox(stream, moov => {
+                var tracks = SplitBox(moov, out var moovHeader);
+                var index = tracks.FindIndex(box => GetFourCC(box.AsSpan(4)) == @"trak" && GetHandlerType(box) == @"soun");
+                if (index < 0)
+                    return moov;
+                var children = SplitBox(tracks[index], out var trakHeader);
+                var udtaIndex = children.FindIndex(box => GetFourCC(box.AsSpan(4)) == @"udta");
+                var udtaHeader = CreateBox(@"udta", Array.Empty<byte>());
+                var userData = udtaIndex >= 0 ? SplitBox(children[udtaIndex], out udtaHeader) : new List<byte[]>();
+                userData.RemoveAll(box => GetFourCC(box.AsSpan(4)) == @"ludt");
+                userData.Add(ludt);
+                if (udtaIndex >= 0)
+                    children[udtaIndex] = JoinBox(udtaHeader, userData);
+                else
+                    children.Add(JoinBox(udtaHeader, userData));
+                tracks[index] = JoinBox(trakHeader, children);
+                return JoinBox(moovHeader, tracks);
+            });
+        }
+
+        /// <summary>
+        /// Read the integrated program loudness from the audio track of an MP4 or MOV file.
+        /// </summary>
+        /// <param name="path">MP4 or MOV file path.</param>
+        /// <returns>Integrated loudness in LUFS, or `null` if the file has no loudness metadata.</returns>
+        public static float? ReadLoudness(string path) {
+            try {
+                using var stream = new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.Read);
+                var moov = FindBox(stream, 0L, stream.Length, @"moov");
+                if (moov == null)
+                    return null;
+                for (var trak = FindBox(stream, moov.Value.dataOffset, moov.Value.end, @"trak"); trak != null; trak = FindBox(stream, trak.Value.end, moov.Value.end, @"trak")) {
+                    if (GetHandlerType(stream, trak.Value) != @"soun")
+                        continue;
+                    var udta = FindBox(stream, trak.Value.dataOffset, trak.Value.end, @"udta");
+                    var ludt = udta != null ? FindBox(stream, udta.Value.dataOffset, udta.Value.end, @"ludt") : null;
+                    var tlou = ludt != null ? FindBox(stream, ludt.Value.dataOffset, ludt.Value.end, @"tlou") : null;
+                    if (tlou == null)
+                        return null;
+                    var payload = ReadPayload(stream, tlou.Value);
+                    if (payload.Length < 11)
+                        return null;
+                    for (int i = 0, count = payload[10]; i < count && 11 + 3 * i + 3 <= payload.Length; ++i)
+                        if (payload[11 + 3 * i] == 1) // program loudness
+                            return payload[12 + 3 * i] / 4f - 57.75f;
+                    return null;
+                }
+                return null;
+            } catch (IOException) {
+                return null;
+            } catch (InvalidDataException) {
+                return null;
+            }
+        }
+
+        /// <summary>
+        /// Write a display transform into the video track header of an MP4 or MOV file.
+        /// Pixel data is left untouched, so this does not require re-encoding.
+        /// </summary>
+        /// <param name="path">MP4 or MOV file path.</param>
+        /// <param name="rotation">Clockwise display rotation.</param>
+        /// <param name="mirrored">Whether the video should be horizontally mirrored before rotating.</param>
+        public static void SetDisplayTransform(
+            string path,
+            PixelBuffer.Rotation rotation,
+            bool mirrored
+        ) {
+            using var stream = new FileStream(path, FileMode.Open, FileAccess.ReadWrite, FileShare.Read);
+            // Find video track header
+            var moov = FindBox(stream, 0L, stream.Length, @"moov") ?? throw new InvalidOperationException($"Cannot set display transform because file is not a valid MP4 file: {path}");
+            var tkhd = default(Box?);
+            for (var offset = moov.dataOffset; offset < moov.end;) {
+                var trak = FindBox(stream, offset, moov.end, @"trak");
+                if (trak == null)
+                    break;
+                if (GetHandlerType(stream, trak.Value) == @"vide") {
+                    tkhd = FindBox(stream, trak.Value.dataOffset, trak.Value.end, @"tkhd");
+                    break;
+                }
+                offset = trak.Value.end;
+            }
+            if (tkhd == null)
+                throw new InvalidOperationException($"Cannot set display transform because file has no video track: {path}");
+            // Read header
+            var header = ReadPayload(stream, tkhd.Value);
+            var matrixOffset = header[0] == 1 ? 52 : 40;
+            var width = BinaryPrimitives.ReadInt32BigEndian(header.AsSpan(matrixOffset + 36)) >> 16;
+            var height = BinaryPrimitives.ReadInt32BigEndian(header.AsSpan(matrixOffset + 40)) >> 16;
+            // Write matrix
+            var matrix = CreateDisplayMatrix(width, height, rotation, mirrored);
+            for (var i = 0; i < matrix.Length; ++i)
+                BinaryPrimitives.WriteInt32BigEndian(header.AsSpan(matrixOffset + 4 * i), matrix[i]);
+            stream.Position = tkhd.Value.dataOffset + matrixOffset;
+            stream.Write(header, matrixOffset, matrix.Length * sizeof(int));
+        }
+        #endregion
+
+
+        #region --Operations--
+        private static readonly byte[] DefaultFileType = {
+            (byte)'i', (byte)'s', (byte)'o', (byte)'m', 0, 0, 2, 0,
+            (byte)'i', (byte)'s', (byte)'o', (byte)'m', (byte)'i', (byte)'s', (byte)'o', (byte)'2',
+            (byte)'m', (byte)'p', (byte)'4', (byte)'1'
+        };
+        private static readonly byte[] IdentityMatrix = {
+            0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0x40, 0, 0, 0
+        };
+        private const double ChunkDuration = 0.5;
+        private const uint MetadataTimescale = 90_000;
+        private const string MetadataMimeType = @"application/octet-stream";
+        private const string MetadataHandlerName = @"VideoKit Metadata";
+
+        internal readonly struct Box {
+            public readonly string type;
+            public readonly long offset;
+            public readonly long dataOffset;
+            public readonly long end;
+
+            public Box(string type, long offset, long dataOffset, long end) {
+                this.type = type;
+                this.offset = offset;
+                this.dataOffset = dataOffset;
+                this.end = end;
+            }
+        }
+
+        private readonly struct Chunk {
+            public readonly long offset;
+            public readonly int count;
+            public readonly int description;
+
+            public Chunk(long offset, int count, int description) {
+                this.offset = offset;
+                this.count = count;
+                this.description = description;
+            }
+        }
+
+        internal static Box? ReadBox(Stream stream, long offset, long end) {
+            // Check
+            if (end - offset < 8)
+                return null;
+            // Read header
+            Span<byte> header = stackalloc byte[16];
+            stream.Position = offset;
+            ReadExactly(stream, header.Slice(0, 8));
+            var size = (long)BinaryPrimitives.ReadUInt32BigEndian(header);
+            var type = GetFourCC(header.Slice(4, 4));
+            var dataOffset = offset + 8;
+            if (size == 1) {
+                ReadExactly(stream, header.Slice(8, 8));
+                size = (long)BinaryPrimitives.ReadUInt64BigEndian(header.Slice(8));
+                dataOffset += 8;
+            } else if (size == 0)
+                size = end - offset;
+            // Check size
+            if (size < dataOffset - offset || offset + size > end)
+                throw new InvalidDataException($"MP4 box '{type}' at offset {offset} has invalid size {size}");
+            // Return
+            return new Box(type, offset, dataOffset, offset + size);
+        }
+
+        internal static Box? FindBox(Stream stream, long offset, long end, string type) {
+            while (ReadBox(stream, offset, end) is Box box) {
+                if (box.type == type)
+                    return box;
+                offset = box.end;
+            }
+            return null;
+        }
+
+        private static Movie? TryRead(string path) {
+            try {
+                return Read(path);
+            } catch (InvalidDataException) {
+                return null;
+            } catch (EndOfStreamException) {
+                return null;
+            }
+        }
+
+        private static byte[] ReadPayload(Stream stream, Box box) {
+            var payload = new byte[box.end - box.dataOffset];
+            stream.Position = box.dataOffset;
+            ReadExactly(stream, payload);
+            return payload;
+        }
+
+        private static string? GetHandlerType(Stream stream, Box trak) {
+            var mdia = FindBox(stream, trak.dataOffset, trak.end, @"mdia");
+            if (mdia == null)
+                return null;
+            var hdlr = FindBox(stream, mdia.Value.dataOffset, mdia.Value.end, @"hdlr");
+            if (hdlr == null || hdlr.Value.end - hdlr.Value.dataOffset < 12)
+                return null;
+            Span<byte> header = stackalloc byte[12];
+            stream.Position = hdlr.Value.dataOffset;
+            ReadExactly(stream, header);
+            return GetFourCC(header.Slice(8, 4));
+        }
+
+        private static string? GetHandlerType(byte[] trak) {
+            using var stream = new MemoryStream(trak);
+            return GetHandlerType(stream, ReadBox(stream, 0L, trak.Length)!.Value);
+        }
+
+        private static Track ReadTrack(Stream stream, Box trak, string path) {
+            var track = new Track();
+            var stbl = default(Box?);
+            // Read headers
+            for (var box = ReadBox(stream, trak.dataOffset, trak.end); box != null; box = ReadBox(stream, box.Value.end, trak.end))
+                switch (box.Value.type) {
+                    case @"tkhd":
+                        track.header = ReadPayload(stream, box.Value);
+                        break;
+                    case @"edts":
+                        track.mediaTime = ReadMediaTime(stream, box.Value);
+                        break;
+                    case @"udta":
+                        for (var child = ReadBox(stream, box.Value.dataOffset, box.Value.end); child != null; child = ReadBox(stream, child.Value.end, box.Value.end)) {
+                            var data = new byte[child.Value.end - child.Value.offset];
+                            stream.Position = child.Value.offset;
+                            ReadExactly(stream, data);
+                            track.userData.Add(data);
+                        }
+                        break;
+                    case @"mdia":
+                        for (var child = ReadBox(stream, box.Value.dataOffset, box.Value.end); child != null; child = ReadBox(stream, child.Value.end, box.Value.end))
+                            if (child.Value.type == @"mdhd")
+                                track.mediaHeader = ReadPayload(stream, child.Value);
+                            else if (child.Value.type == @"hdlr") {
+                                track.handlerReference = ReadPayload(stream, child.Value);
+                                track.handler = GetFourCC(track.handlerReference.AsSpan(8, 4));
+                            } else if (child.Value.type == @"minf")
+                                for (var info = ReadBox(stream, child.Value.dataOffset, child.Value.end); info != null; info = ReadBox(stream, info.Value.end, child.Value.end))
+                                    if (info.Value.type == @"stbl")
+                                        stbl = info;
+                                    else {
+                                        var data = new byte[info.Value.end - info.Value.offset];
+                                        stream.Position = info.Value.offset;
+                                        ReadExactly(stream, data);
+                                        track.mediaInformation.Add(data);
+                                    }
+                        break;
+                }
+            // Read samples
+            if (stbl != null)
+                ReadSampleTable(stream, stbl.Value, track, path);
+            return track;
+        }
+
+        private static long ReadMediaTime(Stream stream, Box edts) {
+            var elst = FindBox(stream, edts.dataOffset, edts.end, @"elst");
+            if (elst == null)
+                return 0L;
+            var payload = ReadPayload(stream, elst.Value);
+            var version = payload[0];
+            var count = BinaryPrimitives.ReadUInt32BigEndian(payload.AsSpan(4));
+            var entrySize = version == 1 ? 20 : 12;
+            for (var i = 0; i < count; ++i) {
+                var entry = payload.AsSpan(8 + i * entrySize);
+                var mediaTime = version == 1 ?
+                    BinaryPrimitives.ReadInt64BigEndian(entry.Slice(8)) :
+                    BinaryPrimitives.ReadInt32BigEndian(entry.Slice(4));
+                if (mediaTime >= 0) // skip empty edits
+                    return mediaTime;
+            }
+            return 0L;
+        }
+
+        private static void ReadSampleTable(Stream stream, Box stbl, Track track, string path) {
+            var tables = new Dictionary<string, byte[]>();
+            for (var box = ReadBox(stream, stbl.dataOffset, stbl.end); box != null; box = ReadBox(stream, box.Value.end, stbl.end))
+                tables[box.Value.type] = ReadPayload(stream, box.Value);
+            // Read sample descriptions
+            if (tables.TryGetValue(@"stsd", out var stsd)) {
+                var descriptionCount = BinaryPrimitives.ReadUInt32BigEndian(stsd.AsSpan(4));
+                for (int i = 0, offset = 8; i < descriptionCount; ++i) {
+                    var size = (int)BinaryPrimitives.ReadUInt32BigEndian(stsd.AsSpan(offset));
+                    track.sampleDescriptions.Add(stsd.AsSpan(offset, size).ToArray());
+                    offset += size;
+                }
+            }
+            // Read sample sizes
+            if (!tables.TryGetValue(@"stsz", out var stsz))
+                return;
+            var fixedSize = BinaryPrimitives.ReadInt32BigEndian(stsz.AsSpan(4));
+            var sampleCount = BinaryPrimitives.ReadInt32BigEndian(stsz.AsSpan(8));
+            var samples = new Sample[sampleCount];
+            for (var i = 0; i < sampleCount; ++i)
+                samples[i] = new Sample {
+                    path = path,
+                    size = fixedSize != 0 ? fixedSize : BinaryPrimitives.ReadInt32BigEndian(stsz.AsSpan(12 + 4 * i)),
+                    sync = true
+                };
+            // Read durations
+            if (tables.TryGetValue(@"stts", out var stts))
+                for (int i = 0, s = 0, count = BinaryPrimitives.ReadInt32BigEndian(stts.AsSpan(4)); i < count; ++i) {
+                    var runLength = BinaryPrimitives.ReadInt32BigEndian(stts.AsSpan(8 + 8 * i));
+                    var duration = BinaryPrimitives.ReadUInt32BigEndian(stts.AsSpan(12 + 8 * i));
+                    for (var j = 0; j < runLength && s < sampleCount; ++j)
+                        samples[s++].duration = duration;
+                }
+            // Read composition offsets
+            if (tables.TryGetValue(@"ctts", out var ctts))
+                for (int i = 0, s = 0, count = BinaryPrimitives.ReadInt32BigEndian(ctts.AsSpan(4)); i < count; ++i) {
+                    var runLength = BinaryPrimitives.ReadInt32BigEndian(ctts.AsSpan(8 + 8 * i));
+                    var offset = BinaryPrimitives.ReadInt32BigEndian(ctts.AsSpan(12 + 8 * i));
+                    for (var j = 0; j < runLength && s < sampleCount; ++j)
+                        samples[s++].compositionOffset = offset;
+                }
+            // Read sync samples
+            if (tables.TryGetValue(@"stss", out var stss)) {
+                for (var i = 0; i < sampleCount; ++i)
+                    samples[i].sync = false;
+                for (int i = 0, count = BinaryPrimitives.ReadInt32BigEndian(stss.AsSpan(4)); i < count; ++i) {
+                    var index = BinaryPrimitives.ReadInt32BigEndian(stss.AsSpan(8 + 4 * i)) - 1;
+                    if (index >= 0 && index < sampleCount)
+                        samples[index].sync = true;
+                }
+            }
+            // Read chunk offsets
+            var chunkOffsets = new List<long>();
+            if (tables.TryGetValue(@"stco", out var stco))
+                for (int i = 0, count = BinaryPrimitives.ReadInt32BigEndian(stco.AsSpan(4)); i < count; ++i)
+                    chunkOffsets.Add(BinaryPrimitives.ReadUInt32BigEndian(stco.AsSpan(8 + 4 * i)));
+            else if (tables.TryGetValue(@"co64", out var co64))
+                for (int i = 0, count = BinaryPrimitives.ReadInt32BigEndian(co64.AsSpan(4)); i < count; ++i)
+                    chunkOffsets.Add(BinaryPrimitives.ReadInt64BigEndian(co64.AsSpan(8 + 8 * i)));
+            // Assign sample offsets
+            if (!tables.TryGetValue(@"stsc", out var stsc))
+                throw new InvalidDataException($"Cannot read track because sample table has no sample-to-chunk box: {path}");
+            var entryCount = BinaryPrimitives.ReadInt32BigEndian(stsc.AsSpan(4));
+            for (int i = 0, sampleIdx = 0; i < entryCount; ++i) {
+                var firstChunk = BinaryPrimitives.ReadInt32BigEndian(stsc.AsSpan(8 + 12 * i)) - 1;
+                var lastChunk = i + 1 < entryCount ? BinaryPrimitives.ReadInt32BigEndian(stsc.AsSpan(20 + 12 * i)) - 1 : chunkOffsets.Count;
+                var samplesPerChunk = BinaryPrimitives.ReadInt32BigEndian(stsc.AsSpan(12 + 12 * i));
+                var description = BinaryPrimitives.ReadInt32BigEndian(stsc.AsSpan(16 + 12 * i)) - 1;
+                for (var chunkIdx = firstChunk; chunkIdx < lastChunk && chunkIdx < chunkOffsets.Count; ++chunkIdx) {
+                    var offset = chunkOffsets[chunkIdx];
+                    for (var j = 0; j < samplesPerChunk && sampleIdx < sampleCount; ++j, ++sampleIdx) {
+                        samples[sampleIdx].offset = offset;
+                        samples[sampleIdx].description = description;
+                        offset += samples[sampleIdx].size;
+                    }
+                }
+            }
+            track.samples.AddRange(samples);
+        }
+
+        private static List<Chunk>[] WriteSamples(
+            Movie movie,
+            Stream stream,
+            Dictionary<string, FileStream> sources
+        ) {
+            var tracks = movie.tracks;
+            var chunks = tracks.Select(_ => new List<Chunk>()).ToArray();
+            var positions = new int[tracks.Count];
+            var times = new long[tracks.Count];
+            var buffer = ArrayPool<byte>.Shared.Rent(1 << 16);
+            try {
+                for (;;) {
+                    // Pick the track with the earliest pending sample
+                    var trackIdx = -1;
+                    for (var i = 0; i < tracks.Count; ++i)
+                        if (
+                            positions[i] < tracks[i].samples.Count &&
+                            (trackIdx < 0 || (double)times[i] / tracks[i].timescale < (double)times[trackIdx] / tracks[trackIdx].timescale)
+                        )
+                            trackIdx = i;
+                    if (trackIdx < 0)
+                        break;
+                    // Write chunk
+                    var track = tracks[trackIdx];
+                    var chunkOffset = stream.Position;
+                    var chunkEnd = times[trackIdx] + (long)(ChunkDuration * track.timescale);
+                    var description = track.samples[positions[trackIdx]].description;
+                    var count = 0;
+                    while (
+                        positions[trackIdx] < track.samples.Count &&
+                        (count == 0 || times[trackIdx] < chunkEnd) &&
+                        track.samples[positions[trackIdx]].description == description
+                    ) {
+                        var sample = track.samples[positions[trackIdx]++];
+                        CopySample(sample, stream, sources, buffer);
+                        times[trackIdx] += sample.duration;
+                        ++count;
+                    }
+                    chunks[trackIdx].Add(new Chunk(chunkOffset, count, description));
+                }
+            } finally {
+                ArrayPool<byte>.Shared.Return(buffer);
+            }
+            return chunks;
+        }
+
+        private static void CopySample(
+            in Sample sample,
+            Stream stream,
+            Dictionary<string, FileStream> sources,
+            byte[] buffer
+        ) {
+            var size = sample.size;
+            if (sample.prefix != null) {
+                stream.Write(sample.prefix, 0, sample.prefix.Length);
+                size -= sample.prefix.Length;
+            }
+            if (sample.data != null) {
+                stream.Write(sample.data, 0, size);
+                return;
+            }
+            if (!sources.TryGetValue(sample.path!, out var source)) {
+                source = new FileStream(sample.path!, FileMode.Open, FileAccess.Read, FileShare.Read, 1 << 16);
+                sources.Add(sample.path!, source);
+            }
+            if (source.Position != sample.offset)
+                source.Position = sample.offset;
+            for (var remaining = size; remaining > 0;) {
+                var count = source.Read(buffer, 0, Math.Min(remaining, buffer.Length));
+                if (count == 0)
+                    throw new EndOfStreamException($"Sample data at offset {sample.offset} is truncated in file: {sample.path}");
+                stream.Write(buffer, 0, count);
+                remaining -= count;
+            }
+        }
+
+        private static byte[] CreateMovieBox(Movie movie, List<Chunk>[] chunks) {
+            using var stream = new MemoryStream();
+            var timescale = movie.timescale;
+            var durations = movie.tracks.Select(track => Rescale(track.duration, track.timescale, timescale)).ToArray();
+            // Write movie header
+            var mvhd = (byte[])movie.header.Clone();
+            var v1 = mvhd[0] == 1;
+            WriteDuration(mvhd, v1 ? 24 : 16, v1, durations.DefaultIfEmpty(0L).Max());
+            var nextTrackId = movie.tracks.Select(track => track.id).DefaultIfEmpty(0u).Max() + 1;
+            BinaryPrimitives.WriteUInt32BigEndian(mvhd.AsSpan(v1 ? 108 : 96), nextTrackId);
+            WriteBox(stream, @"mvhd", mvhd);
+            // Write tracks
+            for (var i = 0; i < movie.tracks.Count; ++i)
+                WriteBox(stream, @"trak", CreateTrackBox(movie.tracks[i], chunks[i], durations[i]));
+            return stream.ToArray();
+        }
+
+        private static byte[] CreateTrackBox(Track track, List<Chunk> chunks, long movieDuration) {
+            using var stream = new MemoryStream();
+            // Write track header
+            var tkhd = (byte[])track.header.Clone();
+            var v1 = tkhd[0] == 1;
+            WriteDuration(tkhd, v1 ? 28 : 20, v1, movieDuration);
+            WriteBox(stream, @"tkhd", tkhd);
+            // Write edit list
+            if (track.mediaTime > 0) {
+                var elst = new byte[20];
+                BinaryPrimitives.WriteUInt32BigEndian(elst.AsSpan(4), 1);
+                BinaryPrimitives.WriteUInt32BigEndian(elst.AsSpan(8), (uint)Math.Min(movieDuration, uint.MaxValue));
+                BinaryPrimitives.WriteInt32BigEndian(elst.AsSpan(12), (int)Math.Min(track.mediaTime, int.MaxValue));
+                BinaryPrimitives.WriteUInt32BigEndian(elst.AsSpan(16), 1 << 16);
+                WriteBox(stream, @"edts", CreateBox(@"elst", elst));
+            }
+            // Write media
+            using var mdia = new MemoryStream();
+            var mdhd = (byte[])track.mediaHeader.Clone();
+            var mv1 = mdhd[0] == 1;
+            WriteDuration(mdhd, mv1 ? 24 : 16, mv1, track.duration);
+            WriteBox(mdia, @"mdhd", mdhd);
+            WriteBox(mdia, @"hdlr", track.handlerReference);
+            using var minf = new MemoryStream();
+            foreach (var box in track.mediaInformation)
+                minf.Write(box, 0, box.Length);
+            WriteBox(minf, @"stbl", CreateSampleTableBox(track, chunks));
+            WriteBox(mdia, @"minf", minf.ToArray());
+            WriteBox(stream, @"mdia", mdia.ToArray());
+            // Write user data
+            if (track.userData.Count > 0)
+                WriteBox(stream, @"udta", track.userData.SelectMany(box => box).ToArray());
+            return stream.ToArray();
+        }
+
+        private static byte[] CreateSampleTableBox(Track track, List<Chunk> chunks) {
+            using var stream = new MemoryStream();
+            var samples = track.samples;
+            // Write sample descriptions
+            using (var stsd = new MemoryStream()) {
+                WriteUInt32(stsd, 0);
+                WriteUInt32(stsd, (uint)track.sampleDescriptions.Count);
+                foreach (var description in track.sampleDescriptions)
+                    stsd.Write(description, 0, description.Length);
+                WriteBox(stream, @"stsd", stsd.ToArray());
+            }
+            // Write durations
+            var stts = CreateRunLengthTable(samples.Select(sample => (int)sample.duration), 0);
+            WriteBox(stream, @"stts", stts);
+            // Write composition offsets
+            if (samples.Any(sample => sample.compositionOffset != 0)) {
+                var version = samples.Any(sample => sample.compositionOffset < 0) ? 1 : 0;
+                WriteBox(stream, @"ctts", CreateRunLengthTable(samples.Select(sample => sample.compositionOffset), version));
+            }
+            // Write sync samples
+            if (samples.Any(sample => !sample.sync))
+                using (var stss = new MemoryStream()) {
+                    var syncSamples = Enumerable.Range(0, samples.Count).Where(i => samples[i].sync).ToArray();
+                    WriteUInt32(stss, 0);
+                    WriteUInt32(stss, (uint)syncSamples.Length);
+                    foreach (var index in syncSamples)
+                        WriteUInt32(stss, (uint)index + 1);
+                    WriteBox(stream, @"stss", stss.ToArray());
+                }
+            // Write sample sizes
+            using (var stsz = new MemoryStream()) {
+                var fixedSize = samples.Count > 0 && samples.All(sample => sample.size == samples[0].size) ? samples[0].size : 0;
+                WriteUInt32(stsz, 0);
+                WriteUInt32(stsz, (uint)fixedSize);
+                WriteUInt32(stsz, (uint)samples.Count);
+                if (fixedSize == 0)
+                    foreach (var sample in samples)
+                        WriteUInt32(stsz, (uint)sample.size);
+                WriteBox(stream, @"stsz", stsz.ToArray());
+            }
+            // Write sample to chunk table
+            using (var stsc = new MemoryStream()) {
+                var entries = new List<(int firstChunk, int count, int description)>();
+                for (var i = 0; i < chunks.Count; ++i)
+                    if (entries.Count == 0 || entries[entries.Count - 1].count != chunks[i].count || entries[entries.Count - 1].description != chunks[i].description + 1)
+                        entries.Add((i + 1, chunks[i].count, chunks[i].description + 1));
+                WriteUInt32(stsc, 0);
+                WriteUInt32(stsc, (uint)entries.Count);
+                foreach (var (firstChunk, count, description) in entries) {
+                    WriteUInt32(stsc, (uint)firstChunk);
+                    WriteUInt32(stsc, (uint)count);
+                    WriteUInt32(stsc, (uint)description);
+                }
+                WriteBox(stream, @"stsc", stsc.ToArray());
+            }
+            // Write chunk offsets
+            using (var stco = new MemoryStream()) {
+                var large = chunks.Any(chunk => chunk.offset > uint.MaxValue);
+                WriteUInt32(stco, 0);
+                WriteUInt32(stco, (uint)chunks.Count);
+                foreach (var chunk in chunks)
+                    if (large) {
+                        WriteUInt32(stco, (uint)(chunk.offset >> 32));
+                        WriteUInt32(stco, (uint)chunk.offset);
+                    } else
+                        WriteUInt32(stco, (uint)chunk.offset);
+                WriteBox(stream, large ? @"co64" : @"stco", stco.ToArray());
+            }
+            return stream.ToArray();
+        }
+
+        private static byte[] CreateRunLengthTable(IEnumerable<int> values, int version) {
+            var runs = new List<(int count, int value)>();
+            foreach (var value in values)
+                if (runs.Count > 0 && runs[runs.Count - 1].value == value)
+                    runs[runs.Count - 1] = (runs[runs.Count - 1].count + 1, value);
+                else
+                    runs.Add((1, value));
+            using var stream = new MemoryStream();
+            WriteUInt32(stream, (uint)version << 24);
+            WriteUInt32(stream, (uint)runs.Count);
+            foreach (var (count, value) in runs) {
+                WriteUInt32(stream, (uint)count);
+                WriteUInt32(stream, (uint)value);
+            }
+            return stream.ToArray();
+        }
+
+        private static void WriteDuration(byte[] header, int offset, bool v1, long duration) {
+            if (v1)
+                BinaryPrimitives.WriteInt64BigEndian(header.AsSpan(offset), duration);
+            else
+                BinaryPrimitives.WriteUInt32BigEndian(header.AsSpan(offset), (uint)Math.Min(duration, uint.MaxValue));
+        }
+
+        private static void UpdateMovieBox(Stream stream, Func<byte[], byte[]> edit) {
+            // Edit movie box
+            var moov = FindBox(stream, 0L, stream.Length, @"moov") ?? throw new InvalidDataException(@"Cannot update movie because file has no movie box");
+            var data = new byte[moov.end - moov.offset];
+            stream.Position = moov.offset;
+            ReadExactly(stream, data);
+            var result = edit(data);
+            // Grow into free space following the movie box
+            var length = stream.Length;
+            var regionEnd = moov.end;
+            while (ReadBox(stream, regionEnd, length) is Box box && (box.type == @"free" || box.type == @"skip"))
+                regionEnd = box.end;
+            var slack = regionEnd - moov.offset - result.Length;
+            // Shift the rest of the file if the movie box does not fit
+            if (regionEnd < length && slack != 0 && slack < 8) {
+                var shift = slack < 0 ? -slack : 8 - slack;
+                ShiftChunkOffsets(result, regionEnd, shift);
+                ShiftData(stream, regionEnd, shift);
+                slack += shift;
+                length += shift;
+                regionEnd += shift;
+            }
+            // Write
+            stream.Position = moov.offset;
+            stream.Write(result, 0, result.Length);
+            if (regionEnd == length)
+                stream.SetLength(stream.Position);
+            else if (slack > 0) {
+                Span<byte> header = stackalloc byte[8];
+                BinaryPrimitives.WriteUInt32BigEndian(header, (uint)slack);
+                WriteFourCC(header.Slice(4), @"free");
+                stream.Write(header);
+            }
+        }
+
+        private static void ShiftData(Stream stream, long offset, long shift) {
+            var buffer = ArrayPool<byte>.Shared.Rent(1 << 16);
+            try {
+                var end = stream.Length;
+                stream.SetLength(end + shift);
+                while (end > offset) {
+                    var count = (int)Math.Min(buffer.Length, end - offset);
+                    end -= count;
+                    stream.Position = end;
+                    ReadExactly(stream, buffer.AsSpan(0, count));
+                    stream.Position = end + shift;
+                    stream.Write(buffer, 0, count);
+                }
+            } finally {
+                ArrayPool<byte>.Shared.Return(buffer);
+            }
+        }
+
+        private static void ShiftChunkOffsets(byte[] moov, long offset, long shift) {
+            using var stream = new MemoryStream(moov);
+            var root = ReadBox(stream, 0L, moov.Length)!.Value;
+            for (var trak = FindBox(stream, root.dataOffset, root.end, @"trak"); trak != null; trak = FindBox(stream, trak.Value.end, root.end, @"trak")) {
+                var mdia = FindBox(stream, trak.Value.dataOffset, trak.Value.end, @"mdia");
+                var minf = mdia != null ? FindBox(stream, mdia.Value.dataOffset, mdia.Value.end, @"minf") : null;
+                var stbl = minf != null ? FindBox(stream, minf.Value.dataOffset, minf.Value.end, @"stbl") : null;
+                if (stbl == null)
+                    continue;
+                for (var box = ReadBox(stream, stbl.Value.dataOffset, stbl.Value.end); box != null; box = ReadBox(stream, box.Value.end, stbl.Value.end)) {
+                    if (box.Value.type != @"stco" && box.Value.type != @"co64")
+                        continue;
+                    var data = moov.AsSpan((int)box.Value.dataOffset, (int)(box.Value.end - box.Value.dataOffset));
+                    var count = BinaryPrimitives.ReadInt32BigEndian(data.Slice(4));
+                    if (box.Value.type == @"stco")
+                        for (var i = 0; i < count; ++i) {
+                            var chunkOffset = (long)BinaryPrimitives.ReadUInt32BigEndian(data.Slice(8 + 4 * i));
+                            chunkOffset += chunkOffset >= offset ? shift : 0L;
+                            if (chunkOffset > uint.MaxValue)
+                                throw new InvalidDataException($"Cannot shift chunk offsets because chunk offset exceeds 32 bits: {chunkOffset}");
+                            BinaryPrimitives.WriteUInt32BigEndian(data.Slice(8 + 4 * i), (uint)chunkOffset);
+                        }
+                    else
+                        for (var i = 0; i < count; ++i) {
+                            var chunkOffset = BinaryPrimitives.ReadInt64BigEndian(data.Slice(8 + 8 * i));
+                            chunkOffset += chunkOffset >= offset ? shift : 0L;
+                            BinaryPrimitives.WriteInt64BigEndian(data.Slice(8 + 8 * i), chunkOffset);
+                        }
+                }
+            }
+        }
+
+        private static List<byte[]> SplitBox(byte[] box, out byte[] header) {
+            using var stream = new MemoryStream(box);
+            var root = ReadBox(stream, 0L, box.Length)!.Value;
+            header = box.AsSpan(0, (int)root.dataOffset).ToArray();
+            var children = new List<byte[]>();
+            for (var child = ReadBox(stream, root.dataOffset, root.end); child != null; child = ReadBox(stream, child.Value.end, root.end))
+                children.Add(box.AsSpan((int)child.Value.offset, (int)(child.Value.end - child.Value.offset)).ToArray());
+            return children;
+        }
+
+        private static byte[] JoinBox(byte[] header, IEnumerable<byte[]> children) {
+            using var stream = new MemoryStream();
+            stream.Write(header, 0, header.Length);
+            foreach (var child in children)
+                stream.Write(child, 0, child.Length);
+            var result = stream.ToArray();
+            if (header.Length == 16)
+                BinaryPrimitives.WriteUInt64BigEndian(result.AsSpan(8), (ulong)result.Length);
+            else
+                BinaryPrimitives.WriteUInt32BigEndian(result, (uint)result.Length);
+            return result;
+        }
+
+        private static byte[]? GetParameterSets(byte[] description, bool hevc, out int lengthSize) {
+            // Find decoder configuration after the visual sample entry fields
+            lengthSize = 0;
+            using var stream = new MemoryStream(description);
+            var box = description.Length > 86 ? FindBox(stream, 86L, description.Length, hevc ? @"hvcC" : @"avcC") : null;
+            if (box == null)
+                return null;
+            var config = ReadPayload(stream, box.Value);
+            // Read parameter set NAL units
+            var units = new List<byte[]>();
+            try {
+                if (hevc) {
+                    lengthSize = (config[21] & 0x3) + 1;
+                    var offset = 23;
+                    for (var i = 0; i < config[22]; ++i) {
+                        var count = BinaryPrimitives.ReadUInt16BigEndian(config.AsSpan(offset + 1));
+                        offset += 3;
+                        for (var j = 0; j < count; ++j) {
+                            var length = BinaryPrimitives.ReadUInt16BigEndian(config.AsSpan(offset));
+                            units.Add(config.AsSpan(offset + 2, length).ToArray());
+                            offset += 2 + length;
+                        }
+                    }
+                } else {
+                    lengthSize = (config[4] & 0x3) + 1;
+                    var offset = 5;
+                    for (var k = 0; k < 2; ++k) { // SPS, then PPS
+                        var count = k == 0 ? config[offset] & 0x1F : config[offset];
+                        offset += 1;
+                        for (var j = 0; j < count; ++j) {
+                            var length = BinaryPrimitives.ReadUInt16BigEndian(config.AsSpan(offset));
+                            units.Add(config.AsSpan(offset + 2, length).ToArray());
+                            offset += 2 + length;
+                        }
+                    }
+                }
+            } catch (ArgumentOutOfRangeException) {
+                return null;
+            } catch (IndexOutOfRangeException) {
+                return null;
+            }
+            // Write length-prefixed NAL units
+            var result = new byte[units.Count * lengthSize + units.Sum(unit => unit.Length)];
+            var position = 0;
+            foreach (var unit in units) {
+                for (var i = 0; i < lengthSize; ++i)
+                    result[position + i] = (byte)(unit.Length >> (8 * (lengthSize - 1 - i)));
+                unit.CopyTo(result, position + lengthSize);
+                position += lengthSize + unit.Length;
+            }
+            return units.Count > 0 ? result : null;
+        }
+
+        private static int EncodePeakLevel(float peak) => float.IsNegativeInfinity(peak) ?
+            0 :
+            (int)Math.Clamp(MathF.Round((20f - peak) * 32f), 1f, 4095f);
+
+        private static byte[] CreateBox(string type, byte[] payload) {
+            using var stream = new MemoryStream();
+            WriteBox(stream, type, payload);
+            return stream.ToArray();
+        }
+
+        private static void WriteBox(Stream stream, string type, byte[] payload) {
+            Span<byte> header = stackalloc byte[8];
+            BinaryPrimitives.WriteUInt32BigEndian(header, (uint)(payload.Length + 8));
+            WriteFourCC(header.Slice(4), type);
+            stream.Write(header);
+            stream.Write(payload, 0, payload.Length);
+        }
+
+        private static void WriteUInt32(Stream stream, uint value) {
+            Span<byte> data = stackalloc byte[4];
+            BinaryPrimitives.WriteUInt32BigEndian(data, value);
+            stream.Write(data);
+        }
+
+        private static int[] CreateDisplayMatrix(
+            int width,
+            int height,
+            PixelBuffer.Rotation rotation,
+            bool mirrored
+        ) {
+            // Matrix maps (x, y) to (a*x + c*y + tx, b*x + d*y + ty)
+            const int One = 1 << 16;
+            var (a, b, c, d, tx, ty) = rotation switch {
+                PixelBuffer.Rotation._90    => (0, One, -One, 0, height, 0),
+                PixelBuffer.Rotation._180   => (-One, 0, 0, -One, width, height),
+                PixelBuffer.Rotation._270   => (0, -One, One, 0, 0, width),
+                _                           => (One, 0, 0, One, 0, 0),
+            };
+            // Mirror horizontally before rotating
+            if (mirrored) {
+                tx += a / One * width;
+                ty += b / One * width;
+                a = -a;
+                b = -b;
+            }
+            // Return, with u, v, w in 2.30 fixed point
+            return new[] { a, b, 0, c, d, 0, tx << 16, ty << 16, 1 << 30 };
+        }
+
+        private static long Rescale(long value, uint from, uint to) => from == to ?
+            value :
+            (long)Math.Round((double)value * to / from);
+
+        private static string GetFourCC(ReadOnlySpan<byte> data) => new string(new[] {
+            (char)data[0],
+            (char)data[1],
+            (char)data[2],
+            (char)data[3]
+        });
+
+        private static void WriteFourCC(Span<byte> data, string type) {
+            for (var i = 0; i < 4; ++i)
+                data[i] = (byte)type[i];
+        }
+
+        private static void ReadExactly(Stream stream, Span<byte> buffer) {
+            while (buffer.Length > 0) {
+                var count = stream.Read(buffer);
+                if (count == 0)
+                    throw new EndOfStreamException();
+                buffer = buffer.Slice(count);
+            }
+        }
+        #endregion
+    }
+}
\ No newline at end of file
@@ -0,0 +1,105 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+#nullable enable
+
+namespace VideoKit.Internal {
+
+    using System;
+    using System.Numerics;
+
+    /// <summary>
+    /// Motion detector which compares downsampled luma planes of consecutive frames.
+    /// </summary>
+    internal sealed class MotionDetector {
+
+        #region --Client API--
+        /// <summary>
+        /// Create a motion detector.
+        /// </summary>
+        /// <param name="width">Frame width.</param>
+        /// <param name="height">Frame height.</param>
+        /// <param name="pixelThreshold">Mean absolute luma difference for a block to be considered in motion.</param>
+        public MotionDetector(int width, int height, int pixelThreshold = 12) {
+            this.factor = Math.Max(1, (width + AnalysisWidth - 1) / AnalysisWidth);
+            this.width = Math.Max(BlockSize, width / factor / BlockSize * BlockSize);
+            this.height = Math.Max(BlockSize, height / factor / BlockSize * BlockSize);
+            this.pixelThreshold = pixelThreshold * BlockSize * BlockSize;
+            this.previous = new byte[this.width * this.height];
+            this.current = new byte[this.width * this.height];
+            this.difference = new byte[this.width * this.height];
+        }
+
+        /// <summary>
+        /// Compute the motion score of an RGBA8888 frame relative to the previous frame.
+        /// </summary>
+        /// <param name="data">RGBA8888 pixel data.</param>
+        /// <param name="width">Frame width.</param>
+        /// <param name="height">Frame height.</param>
+        /// <param name="rowStride">Frame row stride in bytes.</param>
+        /// <returns>Fraction of blocks in motion in range [0, 1].</returns>
+        public float Process(ReadOnlySpan<byte> data, int width, int height, int rowStride) {
+            // Downsample luma
+            var rows = Math.Min(this.height, height / factor);
+            var columns = Math.Min(this.width, width / factor);
+            for (var j = 0; j < rows; ++j) {
+                var srcRow = data.Slice(j * factor * rowStride);
+                var dstRow = current.AsSpan(j * this.width, this.width);
+                for (var i = 0; i < columns; ++i) {
+                    var offset = i * factor * 4;
+                    dstRow[i] = (byte)((77 * srcRow[offset] + 150 * srcRow[offset + 1] + 29 * srcRow[offset + 2]) >> 8);
+                }
+            }
+            // Check first frame
+            (previous, current) = (current, previous);
+            if (!primed) {
+                primed = true;
+                return 0f;
+            }
+            // Compute absolute difference
+            var i0 = 0;
+            var vectorSize = Vector<byte>.Count;
+            for (; i0 <= difference.Length - vectorSize; i0 += vectorSize) {
+                var a = new Vector<byte>(previous, i0);
+                var b = new Vector<byte>(current, i0);
+                (Vector.Max(a, b) - Vector.Min(a, b)).CopyTo(difference, i0);
+            }
+            for (; i0 < difference.Length; ++i0)
+                difference[i0] = (byte)Math.Abs(previous[i0] - current[i0]);
+            // Count blocks in motion
+            var blocksX = this.width / BlockSize;
+            var blocksY = this.height / BlockSize;
+            var motionBlocks = 0;
+            for (var by = 0; by < blocksY; ++by)
+                for (var bx = 0; bx < blocksX; ++bx) {
+                    var sum = 0;
+                    for (var y = 0; y < BlockSize; ++y) {
+                        var offset = (by * BlockSize + y) * this.width + bx * BlockSize;
+                        for (var x = 0; x < BlockSize; ++x)
+                            sum += difference[offset + x];
+                    }
+                    if (sum >= pixelThreshold)
+                        ++motionBlocks;
+                }
+            // Return
+            return (float)motionBlocks / (blocksX * blocksY);
+        }
+        #endregion
+
+
+        #region --Operations--
+        private readonly int factor;
+        private readonly int width;
+        private readonly int height;
+        private readonly int pixelThreshold;
+        private readonly byte[] difference;
+        private byte[] previous;
+        private byte[] current;
+        private bool primed;
+        private const int AnalysisWidth = 160;
+        private const int BlockSize = 8;
+        #endregion
+    }
+}
\ No newline at end of file
@@ -0,0 +1,209 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+#nullable enable
+
+namespace VideoKit.Internal {
+
+    using System;
+    using System.Linq;
+    using Unity.Collections.LowLevel.Unsafe;
+
+    /// <summary>
+    /// Downscales pixel buffers to RGBA8888 by averaging blocks of source pixels.
+    /// Planar YCbCr frames are averaged in their native planes and only converted to RGB at the output resolution,
+    /// so the cost of a full resolution color conversion is avoided.
+    /// </summary>
+    internal sealed class PixelBufferDownscaler {
+
+        #region --Client API--
+        /// <summary>
+        /// Source width.
+        /// </summary>
+        public readonly int sourceWidth;
+
+        /// <summary>
+        /// Source height.
+        /// </summary>
+        public readonly int sourceHeight;
+
+        /// <summary>
+        /// Output width.
+        /// </summary>
+        public readonly int width;
+
+        /// <summary>
+        /// Output height.
+        /// </summary>
+        public readonly int height;
+
+        /// <summary>
+        /// Create a downscaler.
+        /// </summary>
+        /// <param name="sourceWidth">Source width.</param>
+        /// <param name="sourceHeight">Source height.</param>
+        /// <param name="width">Output width. This MUST not be greater than the source width.</param>
+        /// <param name="height">Output height. This MUST not be greater than the source height.</param>
+        public PixelBufferDownscaler(int sourceWidth, int sourceHeight, int width, int height) {
+            // Check
+            if (width <= 0 || height <= 0 || width > sourceWidth || height > sourceHeight)
+                throw new ArgumentException($"Cannot create downscaler because output size is invalid: {width}x{height}");
+            // Precompute column mapping
+            this.sourceWidth = sourceWidth;
+            this.sourceHeight = sourceHeight;
+            this.width = width;
+            this.height = height;
+            this.columns = new int[sourceWidth];
+            this.columnCounts = new int[width];
+            for (var x = 0; x < sourceWidth; ++x) {
+                columns[x] = x * width / sourceWidth;
+                ++columnCounts[columns[x]];
+            }
+            this.sums = new int[3 * width];
+            this.chromaSums = new int[2 * width];
+            this.chromaCounts = new int[width];
+        }
+
+        /// <summary>
+        /// Downscale a pixel buffer.
+        /// </summary>
+        /// <param name="pixelBuffer">Source pixel buffer.</param>
+        /// <param name="destination">Destination RGBA8888 pixel data with size `(width, height)`, with rows stored top to bottom.</param>
+        public unsafe void Downscale(PixelBuffer pixelBuffer, Span<byte> destination) {
+            // Check
+            if (pixelBuffer.width != sourceWidth || pixelBuffer.height != sourceHeight)
+                throw new ArgumentException($"Cannot downscale pixel buffer because its size does not match the downscaler: {pixelBuffer.width}x{pixelBuffer.height}");
+            if (destination.Length < 4 * width * height)
+                throw new ArgumentException($"Cannot downscale pixel buffer because destination has {destination.Length} bytes but {4 * width * height} are required");
+            // Downscale
+            var format = pixelBuffer.format;
+            var mirrored = pixelBuffer.verticallyMirrored;
+            switch (format) {
+                case PixelBuffer.Format.RGBA8888:
+                case PixelBuffer.Format.BGRA8888:
+                    DownscaleRGBA(
+                        (byte*)pixelBuffer.data.GetUnsafeReadOnlyPtr(),
+                        pixelBuffer.rowStride,
+                        format == PixelBuffer.Format.BGRA8888,
+                        mirrored,
+                        destination
+                    );
+                    break;
+                case PixelBuffer.Format.YCbCr420:
+                    var planes = pixelBuffer.planes!.ToArray();
+                    if (planes.Length < 3)
+                        throw new ArgumentException($"Cannot downscale pixel buffer because it has {planes.Length} planes");
+                    DownscaleYCbCr(
+                        planes.Select(plane => (IntPtr)plane.data.GetUnsafeReadOnlyPtr()).ToArray(),
+                        planes.Select(plane => plane.rowStride).ToArray(),
+                        planes.Select(plane => plane.pixelStride).ToArray(),
+                        planes[1].width,
+                        planes[1].height,
+                        mirrored,
+                        destination
+                    );
+                    break;
+                default:
+                    throw new ArgumentException($"Cannot downscale pixel buffer because format is not supported: {format}");
+            }
+        }
+        #endregion
+
+
+        #region --Operations--
+        private readonly int[] columns;
+        private readonly int[] columnCounts;
+        private readonly int[] sums;
+        private readonly int[] chromaSums;
+        private readonly int[] chromaCounts;
+
+        private unsafe void DownscaleRGBA(byte* data, int rowStride, bool bgra, bool mirrored, Span<byte> destination) {
+            var (red, blue) = bgra ? (2, 0) : (0, 2);
+            for (var j = 0; j < height; ++j) {
+                // Accumulate source rows
+                var (top, bottom) = GetRows(j, height, sourceHeight);
+                Array.Clear(sums, 0, sums.Length);
+                for (var y = top; y < bottom; ++y) {
+                    var row = data + (mirrored ? sourceHeight - 1 - y : y) * rowStride;
+                    for (var x = 0; x < sourceWidth; ++x) {
+                        var pixel = row + 4 * x;
+                        var i = 3 * columns[x];
+                        sums[i] += pixel[red];
+                        sums[i + 1] += pixel[1];
+                        sums[i + 2] += pixel[blue];
+                    }
+                }
+                // Average
+                var output = destination.Slice(4 * j * width, 4 * width);
+                for (var i = 0; i < width; ++i) {
+                    var count = (bottom - top) * columnCounts[i];
+                    output[4 * i] = (byte)(sums[3 * i] / count);
+                    output[4 * i + 1] = (byte)(sums[3 * i + 1] / count);
+                    output[4 * i + 2] = (byte)(sums[3 * i + 2] / count);
+                    output[4 * i + 3] = 255;
+                }
+            }
+        }
+
+        private unsafe void DownscaleYCbCr(
+            IntPtr[] planes,
+            int[] rowStrides,
+            int[] pixelStrides,
+            int chromaWidth,
+            int chromaHeight,
+            bool mirrored,
+            Span<byte> destination
+        ) {
+            var luma = (byte*)planes[0];
+            var cb = (byte*)planes[1];
+            var cr = (byte*)planes[2];
+            for (var j = 0; j < height; ++j) {
+                // Accumulate luma rows
+                var (top, bottom) = GetRows(j, height, sourceHeight);
+                Array.Clear(sums, 0, width);
+                for (var y = top; y < bottom; ++y) {
+                    var row = luma + (mirrored ? sourceHeight - 1 - y : y) * rowStrides[0];
+                    for (var x = 0; x < sourceWidth; ++x)
+                        sums[columns[x]] += row[x * pixelStrides[0]];
+                }
+                // Accumulate chroma rows covering the same block
+                var (chromaTop, chromaBottom) = (top * chromaHeight / sourceHeight, Math.Max(bottom * chromaHeight / sourceHeight, top * chromaHeight / sourceHeight + 1));
+                Array.Clear(chromaSums, 0, chromaSums.Length);
+                Array.Clear(chromaCounts, 0, chromaCounts.Length);
+                for (var y = chromaTop; y < chromaBottom; ++y) {
+                    var row = mirrored ? chromaHeight - 1 - y : y;
+                    var cbRow = cb + row * rowStrides[1];
+                    var crRow = cr + row * rowStrides[2];
+                    for (var x = 0; x < chromaWidth; ++x) {
+                        var i = columns[Math.Min(x * sourceWidth / chromaWidth, sourceWidth - 1)];
+                        chromaSums[2 * i] += cbRow[x * pixelStrides[1]];
+                        chromaSums[2 * i + 1] += crRow[x * pixelStrides[2]];
+                        ++chromaCounts[i];
+                    }
+                }
+                // Convert with BT.601 full range
+                var output = destination.Slice(4 * j * width, 4 * width);
+                for (var i = 0; i < width; ++i) {
+                    var y = (float)sums[i] / ((bottom - top) * columnCounts[i]);
+                    var chromaCount = Math.Max(chromaCounts[i], 1);
+                    var u = (float)chromaSums[2 * i] / chromaCount - 128f;
+                    var v = (float)chromaSums[2 * i + 1] / chromaCount - 128f;
+                    output[4 * i] = ToByte(y + 1.402f * v);
+                    output[4 * i + 1] = ToByte(y - 0.344136f * u - 0.714136f * v);
+                    output[4 * i + 2] = ToByte(y + 1.772f * u);
+                    output[4 * i + 3] = 255;
+                }
+            }
+        }
+
+        private static (int top, int bottom) GetRows(int j, int rows, int sourceRows) {
+            var top = j * sourceRows / rows;
+            return (top, Math.Max((j + 1) * sourceRows / rows, top + 1));
+        }
+
+        private static byte ToByte(float value) => (byte)Math.Clamp(value + 0.5f, 0f, 255f);
+        #endregion
+    }
+}
\ No newline at end of file
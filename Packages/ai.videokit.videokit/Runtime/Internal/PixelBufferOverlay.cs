@@ -0,0 +1,224 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+#nullable enable
+
+namespace VideoKit.Internal {
+
+    using System;
+    using System.Collections.Generic;
+    using UnityEngine;
+
+    /// <summary>
+    /// Overlay compositor which blends a watermark image and timestamp text directly into RGBA8888 pixel data.
+    /// Only the rows and columns covered by the overlay are touched.
+    /// </summary>
+    internal sealed class PixelBufferOverlay {
+
+        #region --Client API--
+        /// <summary>
+        /// Whether to render the current date and time in the upper-left of the frame.
+        /// </summary>
+        public bool timestamp;
+
+        /// <summary>
+        /// Whether the overlay has nothing to render.
+        /// </summary>
+        public bool isEmpty => image == null && !timestamp;
+
+        /// <summary>
+        /// Set the overlay image.
+        /// NOTE: This must be called on the Unity main thread.
+        /// </summary>
+        /// <param name="texture">Overlay image. Pass `null` to remove the image.</param>
+        /// <param name="rect">Display rect in pixel coordinates, with the origin at the bottom-left of the frame.</param>
+        public void SetImage(Texture? texture, Rect rect) {
+            // Check
+            var width = Mathf.RoundToInt(rect.width);
+            var height = Mathf.RoundToInt(rect.height);
+            if (texture == null || width < 1 || height < 1) {
+                image = null;
+                return;
+            }
+            // Render
+            var descriptor = new RenderTextureDescriptor(width, height, RenderTextureFormat.ARGB32, 0) {
+                sRGB = true
+            };
+            var renderTexture = RenderTexture.GetTemporary(descriptor);
+            Graphics.Blit(texture, renderTexture);
+            // Readback
+            var readbackBuffer = new Texture2D(width, height, TextureFormat.RGBA32, false);
+            var prevActive = RenderTexture.active;
+            RenderTexture.active = renderTexture;
+            readbackBuffer.ReadPixels(new Rect(0, 0, width, height), 0, 0, false);
+            RenderTexture.active = prevActive;
+            RenderTexture.ReleaseTemporary(renderTexture);
+            var pixels = readbackBuffer.GetRawTextureData<byte>().ToArray();
+            Texture2D.Destroy(readbackBuffer);
+            // Premultiply
+            for (var i = 0; i < pixels.Length; i += 4) {
+                var alpha = pixels[i + 3];
+                pixels[i + 0] = (byte)((pixels[i + 0] * alpha + 127) / 255);
+                pixels[i + 1] = (byte)((pixels[i + 1] * alpha + 127) / 255);
+                pixels[i + 2] = (byte)((pixels[i + 2] * alpha + 127) / 255);
+            }
+            // Update
+            image = new Layer(pixels, Mathf.RoundToInt(rect.x), Mathf.RoundToInt(rect.y), width, height);
+        }
+
+        /// <summary>
+        /// Blend the overlay into RGBA8888 pixel data.
+        /// This can be called from any thread.
+        /// </summary>
+        /// <param name="data">RGBA8888 pixel data.</param>
+        /// <param name="width">Frame width.</param>
+        /// <param name="height">Frame height.</param>
+        /// <param name="rowStride">Frame row stride in bytes.</param>
+        /// <param name="mirrored">Whether the frame rows are stored bottom-up.</param>
+        public unsafe void Blend(byte* data, int width, int height, int rowStride, bool mirrored) {
+            // Blend image
+            var image = this.image;
+            if (image != null)
+                Blend(image, data, width, height, rowStride, mirrored);
+            // Blend timestamp
+            if (timestamp) {
+                var text = DateTime.Now.ToString(@"yyyy-MM-dd HH:mm:ss");
+                var scale = Math.Max(1, height / 270);
+                var label = this.label;
+                if (label == null || label.text != text || label.scale != scale || label.frameHeight != height)
+                    this.label = label = CreateLabel(text, scale, height);
+                Blend(label.layer, data, width, height, rowStride, mirrored);
+            }
+        }
+        #endregion
+
+
+        #region --Operations--
+        private volatile Layer? image;
+        private volatile Label? label;
+        private const int GlyphWidth = 5;
+        private const int GlyphHeight = 7;
+        private static readonly Dictionary<char, byte[]> Glyphs = new() {
+            ['0'] = new byte[] { 0b01110, 0b10001, 0b10011, 0b10101, 0b11001, 0b10001, 0b01110 },
+            ['1'] = new byte[] { 0b00100, 0b01100, 0b00100, 0b00100, 0b00100, 0b00100, 0b01110 },
+            ['2'] = new byte[] { 0b01110, 0b10001, 0b00001, 0b00010, 0b00100, 0b01000, 0b11111 },
+            ['3'] = new byte[] { 0b11111, 0b00010, 0b00100, 0b00010, 0b00001, 0b10001, 0b01110 },
+            ['4'] = new byte[] { 0b00010, 0b00110, 0b01010, 0b10010, 0b11111, 0b00010, 0b00010 },
+            ['5'] = new byte[] { 0b11111, 0b10000, 0b11110, 0b00001, 0b00001, 0b10001, 0b01110 },
+            ['6'] = new byte[] { 0b00110, 0b01000, 0b10000, 0b11110, 0b10001, 0b10001, 0b01110 },
+            ['7'] = new byte[] { 0b11111, 0b00001, 0b00010, 0b00100, 0b01000, 0b01000, 0b01000 },
+            ['8'] = new byte[] { 0b01110, 0b10001, 0b10001, 0b01110, 0b10001, 0b10001, 0b01110 },
+            ['9'] = new byte[] { 0b01110, 0b10001, 0b10001, 0b01111, 0b00001, 0b00010, 0b01100 },
+            ['-'] = new byte[] { 0b00000, 0b00000, 0b00000, 0b11111, 0b00000, 0b00000, 0b00000 },
+            [':'] = new byte[] { 0b00000, 0b01100, 0b01100, 0b00000, 0b01100, 0b01100, 0b00000 },
+            ['.'] = new byte[] { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b01100, 0b01100 },
+            ['/'] = new byte[] { 0b00001, 0b00010, 0b00010, 0b00100, 0b01000, 0b01000, 0b10000 },
+        };
+
+        private sealed class Layer {
+            public readonly byte[] pixels; // premultiplied RGBA8888, bottom-up
+            public readonly int x;
+            public readonly int y;
+            public readonly int width;
+            public readonly int height;
+
+            public Layer(byte[] pixels, int x, int y, int width, int height) {
+                this.pixels = pixels;
+                this.x = x;
+                this.y = y;
+                this.width = width;
+                this.height = height;
+            }
+        }
+
+        private sealed class Label {
+            public readonly string text;
+            public readonly int scale;
+            public readonly int frameHeight;
+            public readonly Layer layer;
+
+            public Label(string text, int scale, int frameHeight, Layer layer) {
+                this.text = text;
+                this.scale = scale;
+                this.frameHeight = frameHeight;
+                this.layer = layer;
+            }
+        }
+
+        private static unsafe void Blend(
+            Layer layer,
+            byte* data,
+            int width,
+            int height,
+            int rowStride,
+            bool mirrored
+        ) {
+            var minX = Math.Max(layer.x, 0);
+            var maxX = Math.Min(layer.x + layer.width, width);
+            if (minX >= maxX)
+                return;
+            fixed (byte* pixels = layer.pixels)
+                for (var j = 0; j < layer.height; ++j) {
+                    // Check row
+                    var y = layer.y + j;
+                    if (y < 0 || y >= height)
+                        continue;
+                    // Blend row
+                    var src = pixels + (j * layer.width + minX - layer.x) * 4;
+                    var dst = data + (mirrored ? y : height - 1 - y) * rowStride + minX * 4;
+                    for (var i = 0; i < maxX - minX; ++i, src += 4, dst += 4) {
+                        var alpha = src[3];
+                        if (alpha == 0)
+                            continue;
+                        if (alpha == 255) {
+                            *(uint*)dst = *(uint*)src;
+                            continue;
+                        }
+                        var inverse = 255 - alpha;
+                        dst[0] = (byte)(src[0] + (dst[0] * inverse + 127) / 255);
+                        dst[1] = (byte)(src[1] + (dst[1] * inverse + 127) / 255);
+                        dst[2] = (byte)(src[2] + (dst[2] * inverse + 127) / 255);
+                        dst[3] = (byte)(alpha + (dst[3] * inverse + 127) / 255);
+                    }
+                }
+        }
+
+        private static Label CreateLabel(string text, int scale, int frameHeight) {
+            // Rasterize glyphs with a drop shadow
+            var advance = (GlyphWidth + 1) * scale;
+            var width = text.Length * advance + scale;
+            var height = (GlyphHeight + 1) * scale;
+            var pixels = new byte[width * height * 4];
+            for (var pass = 0; pass < 2; ++pass) {
+                var offset = pass == 0 ? scale : 0;
+                var value = pass == 0 ? (byte)0 : (byte)255;
+                for (var c = 0; c < text.Length; ++c) {
+                    if (!Glyphs.TryGetValue(text[c], out var glyph))
+                        continue;
+                    for (var row = 0; row < GlyphHeight; ++row)
+                        for (var col = 0; col < GlyphWidth; ++col) {
+                            if ((glyph[row] & (1 << (GlyphWidth - 1 - col))) == 0)
+                                continue;
+                            for (var sy = 0; sy < scale; ++sy)
+                                for (var sx = 0; sx < scale; ++sx) {
+                                    var x = c * advance + col * scale + sx + offset;
+                                    var y = height - 1 - (row * scale + sy + offset); // bottom-up
+                                    var idx = (y * width + x) * 4;
+                                    pixels[idx + 0] = value;
+                                    pixels[idx + 1] = value;
+                                    pixels[idx + 2] = value;
+                                    pixels[idx + 3] = 255;
+                                }
+                        }
+                }
+            }
+            // Place in the upper-left of the frame
+            var margin = 4 * scale;
+            var layer = new Layer(pixels, margin, frameHeight - margin - height, width, height);
+            return new Label(text, scale, frameHeight, layer);
+        }
+        #endregion
+    }
+}
\ No newline at end of file
@@ -0,0 +1,50 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+#nullable enable
+
+namespace VideoKit.Internal {
+
+    using System;
+    using System.Buffers;
+    using System.Runtime.InteropServices;
+
+    /// <summary>
+    /// This is basically a wrapper of a `PixelBuffer` along with bits required to save on allocations.
+    /// </summary>
+    internal readonly struct PixelBufferPacket : IDisposable {
+
+        public readonly byte[] data; // allocated via `ArrayPool<T>`
+        public readonly GCHandle handle; // pins `data` so GC keeps it fixed
+        public readonly PixelBuffer buffer; // wraps `data`
+
+        /// <summary>
+        /// Create a packet which contains a `PixelBuffer` backed by data allocated from a memory pool.
+        /// </summary>
+        /// <param name="width">Pixel buffer width.</param>
+        /// <param name="height">Pixel buffer height.</param>
+        /// <param name="timestamp">Pixel buffer timestamp.</param>
+        public unsafe PixelBufferPacket(int width, int height, long timestamp) {
+            data = ArrayPool<byte>.Shared.Rent(width * height * 4);
+            handle = GCHandle.Alloc(data, GCHandleType.Pinned);
+            buffer = new PixelBuffer(
+                width: width,
+                height: height,
+                format: PixelBuffer.Format.RGBA8888,
+                data: (byte*)handle.AddrOfPinnedObject(),
+                timestamp: timestamp
+            );
+        }
+
+        /// <summary>
+        /// Dispose the packet.
+        /// </summary>
+        public void Dispose() {
+            buffer.Dispose();
+            handle.Free();
+            ArrayPool<byte>.Shared.Return(data);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,273 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+#nullable enable
+
+namespace VideoKit.Internal {
+
+    using System;
+    using System.Buffers;
+    using System.Linq;
+    using System.Numerics;
+    using System.Runtime.InteropServices;
+    using Unity.Collections.LowLevel.Unsafe;
+    using UnityEngine;
+    using TensorLayout = PixelBuffer.TensorLayout;
+
+    /// <summary>
+    /// Converts pixel buffers into normalized RGB tensors for model inference.
+    /// Resizing, color conversion, normalization, and layout are applied in a single pass over the output,
+    /// writing directly into caller memory.
+    /// </summary>
+    internal static class PixelBufferTensor {
+
+        #region --Client API--
+        /// <summary>
+        /// Convert a pixel buffer into a tensor.
+        /// </summary>
+        /// <param name="pixelBuffer">Pixel buffer.</param>
+        /// <param name="tensor">Destination tensor, either `float` or IEEE half precision `ushort` elements.</param>
+        /// <param name="width">Tensor width.</param>
+        /// <param name="height">Tensor height.</param>
+        /// <param name="layout">Tensor layout.</param>
+        /// <param name="scaleMode">How the pixel buffer is fit into the tensor.</param>
+        /// <param name="mean">Per-channel RGB mean, in range [0, 1].</param>
+        /// <param name="std">Per-channel RGB standard deviation, in range [0, 1].</param>
+        public static unsafe void Convert<T>(
+            PixelBuffer pixelBuffer,
+            Span<T> tensor,
+            int width,
+            int height,
+            TensorLayout layout,
+            ScaleMode scaleMode,
+            float[]? mean,
+            float[]? std
+        ) where T : unmanaged {
+            // Check
+            if (width <= 0 || height <= 0)
+                throw new ArgumentException($"Cannot convert pixel buffer to tensor because tensor size is invalid: {width}x{height}");
+            if (tensor.Length < 3 * width * height)
+                throw new ArgumentException($"Cannot convert pixel buffer to tensor because tensor has {tensor.Length} elements but {3 * width * height} are required");
+            if ((mean != null && mean.Length != 3) || (std != null && std.Length != 3))
+                throw new ArgumentException(@"Cannot convert pixel buffer to tensor because mean and standard deviation must have 3 channels");
+            // Create sampler
+            var source = new Source(pixelBuffer);
+            var (scaleX, scaleY, offsetX, offsetY) = GetTransform(source.width, source.height, width, height, scaleMode);
+            // Compute normalization so that `output = value * scale + bias`
+            var scale = new float[3];
+            var bias = new float[3];
+            for (var c = 0; c < 3; ++c) {
+                var s = std?[c] ?? 1f;
+                scale[c] = 1f / (255f * s);
+                bias[c] = -(mean?[c] ?? 0f) / s;
+            }
+            // Precompute horizontal sampling
+            var x0 = new int[width];
+            var x1 = new int[width];
+            var wx = new float[width];
+            var inside = new bool[width];
+            for (var x = 0; x < width; ++x) {
+                var sx = (x + 0.5f - offsetX) / scaleX - 0.5f;
+                inside[x] = sx >= -0.5f && sx <= source.width - 0.5f;
+                sx = Mathf.Clamp(sx, 0f, source.width - 1);
+                x0[x] = (int)sx;
+                x1[x] = Math.Min(x0[x] + 1, source.width - 1);
+                wx[x] = sx - x0[x];
+            }
+            // Convert each row
+            var pool = ArrayPool<float>.Shared;
+            var row = pool.Rent(3 * width);
+            try {
+                for (var y = 0; y < height; ++y) {
+                    var sy = (y + 0.5f - offsetY) / scaleY - 0.5f;
+                    var rowInside = sy >= -0.5f && sy <= source.height - 0.5f;
+                    sy = Mathf.Clamp(sy, 0f, source.height - 1);
+                    // Sample RGB into planar row buffers
+                    var r = row.AsSpan(0, width);
+                    var g = row.AsSpan(width, width);
+                    var b = row.AsSpan(2 * width, width);
+                    for (var x = 0; x < width; ++x)
+                        if (rowInside && inside[x])
+                            source.Sample(x0[x], x1[x], wx[x], sy, out r[x], out g[x], out b[x]);
+                        else
+                            r[x] = g[x] = b[x] = 0f;
+                    // Normalize
+                    Normalize(r, scale[0], bias[0]);
+                    Normalize(g, scale[1], bias[1]);
+                    Normalize(b, scale[2], bias[2]);
+                    // Write
+                    if (typeof(T) == typeof(float))
+                        Write(row.AsSpan(0, 3 * width), MemoryMarshal.Cast<T, float>(tensor), y, width, height, layout, value => value);
+                    else
+                        Write(row.AsSpan(0, 3 * width), MemoryMarshal.Cast<T, ushort>(tensor), y, width, height, layout, ToHalf);
+                }
+            } finally {
+                pool.Return(row);
+            }
+        }
+        #endregion
+
+
+        #region --Operations--
+
+        private unsafe readonly struct Source {
+
+            public readonly int width;
+            public readonly int height;
+
+            public Source(PixelBuffer pixelBuffer) {
+                this.width = pixelBuffer.width;
+                this.height = pixelBuffer.height;
+                this.format = pixelBuffer.format;
+                this.mirrored = pixelBuffer.verticallyMirrored;
+                switch (format) {
+                    case PixelBuffer.Format.RGBA8888:
+                    case PixelBuffer.Format.BGRA8888:
+                        this.planes = new[] { (IntPtr)pixelBuffer.data.GetUnsafeReadOnlyPtr() };
+                        this.rowStrides = new[] { pixelBuffer.rowStride };
+                        this.pixelStrides = new[] { 4 };
+                        this.chromaWidth = this.chromaHeight = 0;
+                        break;
+                    case PixelBuffer.Format.YCbCr420:
+                        var planes = pixelBuffer.planes!.ToArray();
+                        this.planes = planes.Select(plane => (IntPtr)plane.data.GetUnsafeReadOnlyPtr()).ToArray();
+                        this.rowStrides = planes.Select(plane => plane.rowStride).ToArray();
+                        this.pixelStrides = planes.Select(plane => plane.pixelStride).ToArray();
+                        if (this.planes.Length < 3)
+                            throw new ArgumentException($"Cannot convert pixel buffer to tensor because it has {this.planes.Length} planes");
+                        this.chromaWidth = planes[1].width;
+                        this.chromaHeight = planes[1].height;
+                        break;
+                    default:
+                        throw new ArgumentException($"Cannot convert pixel buffer to tensor because format is not supported: {format}");
+                }
+            }
+
+            public void Sample(int x0, int x1, float wx, float sy, out float r, out float g, out float b) {
+                // Sample RGB
+                var y0 = (int)sy;
+                var y1 = Math.Min(y0 + 1, height - 1);
+                var wy = sy - y0;
+                if (format != PixelBuffer.Format.YCbCr420) {
+                    var row0 = Row(0, y0);
+                    var row1 = Row(0, y1);
+                    var c0 = format == PixelBuffer.Format.RGBA8888 ? 0 : 2;
+                    r = Bilinear(row0, row1, 4 * x0 + c0, 4 * x1 + c0, wx, wy);
+                    g = Bilinear(row0, row1, 4 * x0 + 1, 4 * x1 + 1, wx, wy);
+                    b = Bilinear(row0, row1, 4 * x0 + 2 - c0, 4 * x1 + 2 - c0, wx, wy);
+                    return;
+                }
+                // Sample YCbCr
+                var luma = Bilinear(Row(0, y0), Row(0, y1), x0 * pixelStrides[0], x1 * pixelStrides[0], wx, wy);
+                var cx = 0.5f * (x0 + wx) - 0.25f;
+                var cy = 0.5f * sy - 0.25f;
+                cx = Mathf.Clamp(cx, 0f, chromaWidth - 1);
+                cy = Mathf.Clamp(cy, 0f, chromaHeight - 1);
+                var (cx0, cy0) = ((int)cx, (int)cy);
+                var (cx1, cy1) = (Math.Min(cx0 + 1, chromaWidth - 1), Math.Min(cy0 + 1, chromaHeight - 1));
+                var cb = Bilinear(Row(1, cy0), Row(1, cy1), cx0 * pixelStrides[1], cx1 * pixelStrides[1], cx - cx0, cy - cy0) - 128f;
+                var cr = Bilinear(Row(2, cy0), Row(2, cy1), cx0 * pixelStrides[2], cx1 * pixelStrides[2], cx - cx0, cy - cy0) - 128f;
+                // Convert with BT.601 full range
+                r = Mathf.Clamp(luma + 1.402f * cr, 0f, 255f);
+                g = Mathf.Clamp(luma - 0.344136f * cb - 0.714136f * cr, 0f, 255f);
+                b = Mathf.Clamp(luma + 1.772f * cb, 0f, 255f);
+            }
+
+            private readonly PixelBuffer.Format format;
+            private readonly bool mirrored;
+            private readonly int chromaWidth;
+            private readonly int chromaHeight;
+            private readonly IntPtr[] planes;
+            private readonly int[] rowStrides;
+            private readonly int[] pixelStrides;
+
+            private byte* Row(int plane, int y) {
+                var rows = plane == 0 ? height : chromaHeight;
+                return (byte*)planes[plane] + (mirrored ? rows - 1 - y : y) * rowStrides[plane];
+            }
+
+            private static float Bilinear(byte* row0, byte* row1, int i0, int i1, float wx, float wy) {
+                var top = row0[i0] + wx * (row0[i1] - row0[i0]);
+                var bottom = row1[i0] + wx * (row1[i1] - row1[i0]);
+                return top + wy * (bottom - top);
+            }
+        }
+
+        private static (float scaleX, float scaleY, float offsetX, float offsetY) GetTransform(
+            int sourceWidth,
+            int sourceHeight,
+            int width,
+            int height,
+            ScaleMode scaleMode
+        ) {
+            var (scaleX, scaleY) = ((float)width / sourceWidth, (float)height / sourceHeight);
+            if (scaleMode == ScaleMode.StretchToFill)
+                return (scaleX, scaleY, 0f, 0f);
+            var scale = scaleMode == ScaleMode.ScaleToFit ? Mathf.Min(scaleX, scaleY) : Mathf.Max(scaleX, scaleY);
+            return (scale, scale, 0.5f * (width - scale * sourceWidth), 0.5f * (height - scale * sourceHeight));
+        }
+
+        private static void Normalize(Span<float> values, float scale, float bias) {
+            var vectors = MemoryMarshal.Cast<float, Vector<float>>(values);
+            var vectorScale = new Vector<float>(scale);
+            var vectorBias = new Vector<float>(bias);
+            for (var i = 0; i < vectors.Length; ++i)
+                vectors[i] = vectors[i] * vectorScale + vectorBias;
+            for (var i = vectors.Length * Vector<float>.Count; i < values.Length; ++i)
+                values[i] = values[i] * scale + bias;
+        }
+
+        private static void Write<T>(
+            ReadOnlySpan<float> row,
+            Span<T> tensor,
+            int y,
+            int width,
+            int height,
+            TensorLayout layout,
+            Func<float, T> convert
+        ) where T : unmanaged {
+            if (layout == TensorLayout.NCHW)
+                for (var c = 0; c < 3; ++c) {
+                    var channel = row.Slice(c * width, width);
+                    var destination = tensor.Slice((c * height + y) * width, width);
+                    if (typeof(T) == typeof(float))
+                        channel.CopyTo(MemoryMarshal.Cast<T, float>(destination));
+                    else
+                        for (var x = 0; x < width; ++x)
+                            destination[x] = convert(channel[x]);
+                }
+            else {
+                var destination = tensor.Slice(3 * y * width, 3 * width);
+                for (var x = 0; x < width; ++x)
+                    for (var c = 0; c < 3; ++c)
+                        destination[3 * x + c] = convert(row[c * width + x]);
+            }
+        }
+
+        private static ushort ToHalf(float value) {
+            var bits = BitConverter.SingleToInt32Bits(value);
+            var sign = (bits >> 16) & 0x8000;
+            var exponent = ((bits >> 23) & 0xFF) - 127 + 15;
+            var mantissa = bits & 0x7FFFFF;
+            if (exponent <= 0) { // subnormal or zero
+                if (exponent < -10)
+                    return (ushort)sign;
+                mantissa |= 0x800000;
+                var shift = 14 - exponent;
+                var half = mantissa >> shift;
+                if (((mantissa >> (shift - 1)) & 1) != 0) // round
+                    ++half;
+                return (ushort)(sign | half);
+            }
+            if (exponent >= 31) // overflow, infinity, or NaN
+                return (ushort)(sign | 0x7C00 | (((bits >> 23) & 0xFF) == 0xFF && mantissa != 0 ? 0x200 : 0));
+            var result = sign | (exponent << 10) | (mantissa >> 13);
+            if ((mantissa & 0x1000) != 0) // round half up, carrying into the exponent
+                ++result;
+            return (ushort)result;
+        }
+        #endregion
+    }
+}
\ No newline at end of file
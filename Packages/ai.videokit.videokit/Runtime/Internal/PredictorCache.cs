@@ -0,0 +1,75 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+#nullable enable
+
+namespace VideoKit.Internal {
+
+    using System;
+    using System.IO;
+    using System.Linq;
+    using System.Security.Cryptography;
+
+    /// <summary>
+    /// Integrity checks for the on-disk predictor cache.
+    /// Predictor resources are content addressed, so any cached file named with a SHA-256 digest
+    /// is verified against its contents. Only entries which fail verification are removed,
+    /// so that intact resources do not have to be downloaded again.
+    /// </summary>
+    internal static class PredictorCache {
+
+        #region --Client API--
+        /// <summary>
+        /// Remove corrupt entries from the predictor cache.
+        /// NOTE: This method performs blocking IO and should be called on a background thread.
+        /// </summary>
+        /// <param name="path">Predictor cache directory.</param>
+        /// <param name="progress">Optional progress handler, invoked with the fraction of bytes verified.</param>
+        /// <returns>Number of entries which were removed.</returns>
+        public static int Validate(string path, Action<float>? progress = null) {
+            // Check
+            if (!Directory.Exists(path))
+                return 0;
+            // Verify
+            var files = new DirectoryInfo(path).EnumerateFiles(@"*", SearchOption.AllDirectories).ToArray();
+            var totalBytes = Math.Max(files.Sum(file => file.Length), 1L);
+            var verifiedBytes = 0L;
+            var removed = 0;
+            using var sha256 = SHA256.Create();
+            foreach (var file in files) {
+                var length = file.Length;
+                try {
+                    if (!IsValid(file, sha256)) {
+                        file.Delete();
+                        ++removed;
+                    }
+                } catch (IOException) { // file is in use, so leave it alone
+                } catch (UnauthorizedAccessException) { }
+                verifiedBytes += length;
+                progress?.Invoke((float)verifiedBytes / totalBytes);
+            }
+            return removed;
+        }
+        #endregion
+
+
+        #region --Operations--
+        private static readonly string[] PartialExtensions = new[] { @".tmp", @".part", @".download" };
+
+        private static bool IsValid(FileInfo file, HashAlgorithm sha256) {
+            // Check for interrupted downloads
+            if (file.Length == 0 || PartialExtensions.Contains(file.Extension, StringComparer.OrdinalIgnoreCase))
+                return false;
+            // Check content address
+            var name = Path.GetFileNameWithoutExtension(file.Name);
+            if (name.Length != 64 || !name.All(Uri.IsHexDigit))
+                return true;
+            using var stream = file.OpenRead();
+            var digest = sha256.ComputeHash(stream);
+            return string.Concat(digest.Select(b => b.ToString(@"x2"))).Equals(name, StringComparison.OrdinalIgnoreCase);
+        }
+        #endregion
+    }
+}
\ No newline at end of file
@@ -0,0 +1,175 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+#nullable enable
+
+namespace VideoKit.Internal {
+
+    using System;
+    using System.Collections.Generic;
+    using System.Numerics;
+    using System.Runtime.InteropServices;
+
+    /// <summary>
+    /// Scene detector which finds cuts in a stream of video frames and selects a thumbnail for each scene.
+    /// Frames are compared with the distance between their luma histograms and 8x8 signatures,
+    /// both computed on a subsampled grid so that analysis cost does not grow with resolution.
+    /// </summary>
+    internal sealed class SceneDetector {
+
+        #region --Client API--
+        /// <summary>
+        /// Create a scene detector.
+        /// </summary>
+        /// <param name="width">Frame width.</param>
+        /// <param name="height">Frame height.</param>
+        /// <param name="threshold">Frame distance in range [0, 1] above which a cut is detected.</param>
+        /// <param name="minSceneDuration">Minimum scene duration in seconds.</param>
+        /// <param name="analysisInterval">Minimum interval in seconds between analyzed frames.</param>
+        public SceneDetector(int width, int height, float threshold, float minSceneDuration, float analysisInterval) {
+            this.width = width;
+            this.height = height;
+            this.threshold = threshold;
+            this.minSceneDuration = minSceneDuration;
+            this.analysisInterval = analysisInterval;
+            this.step = Math.Max(Math.Max(width, height) / AnalysisSize, 1);
+            var scale = Math.Min(1f, (float)ThumbnailSize / Math.Max(width, height));
+            this.thumbnailWidth = Math.Max((int)(width * scale), 1);
+            this.thumbnailHeight = Math.Max((int)(height * scale), 1);
+        }
+
+        /// <summary>
+        /// Process a video frame.
+        /// </summary>
+        /// <param name="pixelBuffer">Video frame.</param>
+        public void Process(PixelBuffer pixelBuffer) {
+            // Check interval
+            var time = pixelBuffer.timestamp / 1e+9f;
+            endTime = time;
+            if (previous != null && time - analyzedTime < analysisInterval)
+                return;
+            analyzedTime = time;
+            // Compare with previous frame
+            var statistics = pixelBuffer.ComputeStatistics(step);
+            var distance = previous != null ? GetDistance(previous, statistics) : 0f;
+            previous = statistics;
+            // Detect cut, requiring the distance to stand out from recent motion
+            var cut =
+                distance > threshold &&
+                distance > CutContrast * meanDistance &&
+                time - sceneStartTime >= minSceneDuration;
+            meanDistance += (distance - meanDistance) * 0.1f;
+            if (cut) {
+                FinishScene(time);
+                sceneStartTime = time;
+                return; // don't pick the first frame after a cut, which often blends both scenes
+            }
+            // Score thumbnail, preferring contrasty and well exposed frames without motion
+            var exposure = 1f - Math.Abs(statistics.mean - 127.5f) / 127.5f;
+            var score = statistics.standardDeviation * exposure * (1f - Math.Min(distance / threshold, 1f));
+            if (thumbnailData != null && score <= thumbnailScore)
+                return;
+            thumbnailScore = score;
+            thumbnailTime = time;
+            CaptureThumbnail(pixelBuffer);
+        }
+
+        /// <summary>
+        /// Finish detecting scenes.
+        /// </summary>
+        /// <param name="duration">Video duration in seconds.</param>
+        /// <returns>Detected scenes.</returns>
+        public VideoScene[] Finish(float duration) {
+            if (previous != null)
+                FinishScene(Math.Max(duration, endTime));
+            return scenes.ToArray();
+        }
+        #endregion
+
+
+        #region --Operations--
+        private readonly int width;
+        private readonly int height;
+        private readonly float threshold;
+        private readonly float minSceneDuration;
+        private readonly float analysisInterval;
+        private readonly int step;
+        private readonly int thumbnailWidth;
+        private readonly int thumbnailHeight;
+        private readonly List<VideoScene> scenes = new();
+        private PixelBufferStatistics? previous;
+        private byte[]? frame;
+        private byte[]? thumbnailData;
+        private float thumbnailScore;
+        private float thumbnailTime;
+        private float sceneStartTime;
+        private float analyzedTime;
+        private float endTime;
+        private float meanDistance;
+        private const int AnalysisSize = 128;
+        private const int ThumbnailSize = 256;
+        private const float CutContrast = 3f;
+
+        private void FinishScene(float time) {
+            scenes.Add(new VideoScene(
+                sceneStartTime,
+                time,
+                thumbnailData != null ? thumbnailTime : sceneStartTime,
+                thumbnailWidth,
+                thumbnailHeight,
+                thumbnailData ?? new byte[thumbnailWidth * thumbnailHeight * 4]
+            ));
+            thumbnailData = null;
+            thumbnailScore = 0f;
+        }
+
+        private unsafe void CaptureThumbnail(PixelBuffer pixelBuffer) {
+            // Convert to RGBA
+            frame ??= new byte[width * height * 4];
+            fixed (byte* frameData = frame)
+                using (var rgbaBuffer = new PixelBuffer(width, height, PixelBuffer.Format.RGBA8888, frameData))
+                    pixelBuffer.CopyTo(rgbaBuffer);
+            // Downsample
+            var thumbnail = thumbnailData ??= new byte[thumbnailWidth * thumbnailHeight * 4];
+            for (var j = 0; j < thumbnailHeight; ++j) {
+                var (top, bottom) = (j * height / thumbnailHeight, Math.Max((j + 1) * height / thumbnailHeight, j * height / thumbnailHeight + 1));
+                for (var i = 0; i < thumbnailWidth; ++i) {
+                    var (left, right) = (i * width / thumbnailWidth, Math.Max((i + 1) * width / thumbnailWidth, i * width / thumbnailWidth + 1));
+                    int r = 0, g = 0, b = 0;
+                    for (var y = top; y < bottom; ++y)
+                        for (var x = left; x < right; ++x) {
+                            var offset = 4 * (y * width + x);
+                            r += frame[offset];
+                            g += frame[offset + 1];
+                            b += frame[offset + 2];
+                        }
+                    var count = (bottom - top) * (right - left);
+                    var destination = 4 * ((thumbnailHeight - 1 - j) * thumbnailWidth + i); // textures are bottom-up
+                    thumbnail[destination] = (byte)(r / count);
+                    thumbnail[destination + 1] = (byte)(g / count);
+                    thumbnail[destination + 2] = (byte)(b / count);
+                    thumbnail[destination + 3] = 255;
+                }
+            }
+        }
+
+        private static float GetDistance(PixelBufferStatistics a, PixelBufferStatistics b) {
+            // Histogram distance
+            var histogramA = MemoryMarshal.Cast<int, Vector<int>>(a.histogram);
+            var histogramB = MemoryMarshal.Cast<int, Vector<int>>(b.histogram);
+            var sum = Vector<int>.Zero;
+            for (var i = 0; i < histogramA.Length; ++i)
+                sum += Vector.Abs(histogramA[i] - histogramB[i]);
+            var difference = Vector.Dot(sum, Vector<int>.One);
+            for (var i = histogramA.Length * Vector<int>.Count; i < a.histogram.Length; ++i)
+                difference += Math.Abs(a.histogram[i] - b.histogram[i]);
+            var histogramDistance = difference / (2f * Math.Max(Math.Max(a.pixelCount, b.pixelCount), 1));
+            // Signature distance, which catches cuts between scenes with similar tones
+            var signatureDistance = Math.Min(2f * a.GetSignatureDistance(b), 1f);
+            return 0.5f * (histogramDistance + signatureDistance);
+        }
+        #endregion
+    }
+}
\ No newline at end of file
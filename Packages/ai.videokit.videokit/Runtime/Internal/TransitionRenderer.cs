@@ -0,0 +1,314 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+#nullable enable
+
+namespace VideoKit.Internal {
+
+    using System;
+    using System.Collections.Generic;
+    using System.IO;
+    using System.Linq;
+    using System.Numerics;
+    using System.Runtime.InteropServices;
+    using System.Threading.Tasks;
+    using UnityEngine;
+    using Transition = MediaAsset.Transition;
+
+    /// <summary>
+    /// Concatenates videos with transitions by smart rendering.
+    /// Only the groups of pictures which overlap a transition window are decoded, blended, and re-encoded.
+    /// All other samples are stream-copied, so export time grows with the number of transitions instead of the total duration.
+    /// </summary>
+    internal static class TransitionRenderer {
+
+        #region --Client API--
+        /// <summary>
+        /// Concatenate MP4 or MOV videos with transitions between them.
+        /// </summary>
+        /// <param name="assets">Video assets to concatenate.</param>
+        /// <param name="transition">Transition between consecutive videos.</param>
+        /// <param name="duration">Transition duration in seconds.</param>
+        /// <param name="format">Destination format. Videos which are not MP4 or MOV files encoded with the codec of this format are re-encoded first.</param>
+        /// <param name="prefix">Subdirectory name to save recordings.</param>
+        /// <returns>Concatenated media asset.</returns>
+        public static async Task<MediaAsset> Concatenate(
+            MediaAsset[] assets,
+            Transition transition,
+            float duration,
+            MediaRecorder.Format format,
+            string? prefix
+        ) {
+            // Check
+            if (!MP4Container.IsSupported(format))
+                throw new NotImplementedException($"Concatenate with transitions requires an MP4 or MOV destination format: {format}");
+            // Read movies
+            assets = assets.ToArray();
+            var paths = assets.Select(asset => asset.path).ToArray();
+            var movies = await Task.Run(() => paths.Select(path => path != null ? TryRead(path) : null).ToArray());
+            var tracks = movies.Select(movie => movie?.GetTrack(@"vide")).ToArray();
+            // Re-encode videos which cannot be stream-copied into the destination format
+            var transcoded = new List<MediaAsset>();
+            var segments = new List<MediaAsset>();
+            try {
+                for (var i = 0; i < assets.Length; ++i) {
+                    var track = tracks[i];
+                    if (track != null && track.samples.Count > 0 && MP4Container.HasCodec(track, format))
+                        continue;
+                    var asset = await MediaAsset.FromConcatenatingAssets(new[] { assets[i] }, format);
+                    transcoded.Add(asset);
+                    var path = asset.path!;
+                    (assets[i], paths[i]) = (asset, path);
+                    movies[i] = await Task.Run(() => MP4Container.Read(path));
+                    tracks[i] = movies[i]!.GetTrack(@"vide") ?? throw new InvalidDataException($"Cannot concatenate with transitions because re-encoded video has no video track: {path}");
+                }
+                return await Concatenate(assets, movies!, tracks!, transition, duration, format, prefix, segments);
+            } finally {
+                foreach (var asset in segments.Concat(transcoded)) {
+                    var assetPath = asset.path!;
+                    asset.Release();
+                    try { File.Delete(assetPath); }
+                    catch (IOException) { }
+                }
+            }
+        }
+
+        /// <summary>
+        /// Blend two RGBA8888 frames.
+        /// </summary>
+        /// <param name="a">First frame.</param>
+        /// <param name="b">Second frame.</param>
+        /// <param name="weightA">First frame weight.</param>
+        /// <param name="weightB">Second frame weight. The sum of both weights must not exceed one.</param>
+        /// <param name="destination">Destination frame.</param>
+        public static void Blend(
+            ReadOnlySpan<byte> a,
+            ReadOnlySpan<byte> b,
+            float weightA,
+            float weightB,
+            Span<byte> destination
+        ) {
+            var vectorsA = MemoryMarshal.Cast<byte, Vector<byte>>(a);
+            var vectorsB = MemoryMarshal.Cast<byte, Vector<byte>>(b);
+            var vectorsDestination = MemoryMarshal.Cast<byte, Vector<byte>>(destination);
+            var (wa, wb) = (new Vector<float>(weightA), new Vector<float>(weightB));
+            for (var i = 0; i < vectorsA.Length; ++i) {
+                Vector.Widen(vectorsA[i], out var a0, out var a1);
+                Vector.Widen(vectorsB[i], out var b0, out var b1);
+                vectorsDestination[i] = Vector.Narrow(Blend(a0, b0, wa, wb), Blend(a1, b1, wa, wb));
+            }
+            for (var i = vectorsA.Length * Vector<byte>.Count; i < a.Length; ++i)
+                destination[i] = (byte)(a[i] * weightA + b[i] * weightB + 0.5f);
+        }
+        #endregion
+
+
+        #region --Operations--
+
+        private static async Task<MediaAsset> Concatenate(
+            MediaAsset[] assets,
+            MP4Container.Movie[] movies,
+            MP4Container.Track[] tracks,
+            Transition transition,
+            float duration,
+            MediaRecorder.Format format,
+            string? prefix,
+            List<MediaAsset> segments
+        ) {
+            var paths = assets.Select(asset => asset.path!).ToArray();
+            // Find the keyframes which bound each transition window
+            var overlap = transition != Transition.Cut ? duration : 0f;
+            var heads = new int[assets.Length];
+            var tails = new int[assets.Length];
+            for (var i = 0; i < assets.Length; ++i) {
+                var track = tracks[i]!;
+                var decodeTimes = GetDecodeTimes(track);
+                var start = (long)(overlap * track.timescale);
+                var end = track.duration - start;
+                heads[i] = i > 0 && overlap > 0 ?
+                    Enumerable.Range(0, track.samples.Count).Where(j => track.samples[j].sync && decodeTimes[j] >= start).DefaultIfEmpty(track.samples.Count).First() :
+                    0;
+                tails[i] = i + 1 < assets.Length && overlap > 0 ?
+                    Enumerable.Range(0, track.samples.Count).Where(j => track.samples[j].sync && decodeTimes[j] <= end).DefaultIfEmpty(0).Last() :
+                    track.samples.Count;
+                if (heads[i] > tails[i])
+                    throw new ArgumentException($"Cannot concatenate with transitions because video at index {i} has no keyframe between its transitions: {paths[i]}");
+            }
+            // Render transitions
+            MediaAsset.DeleteTemporaryFiles(@"transition_*.mp4");
+            for (var i = 0; i + 1 < assets.Length && overlap > 0; ++i) {
+                var segment = await RenderTransition(
+                    assets[i],
+                    movies[i],
+                    tracks[i],
+                    tails[i],
+                    assets[i + 1],
+                    heads[i + 1],
+                    transition,
+                    overlap,
+                    format,
+                    prefix
+                );
+                segments.Add(segment);
+            }
+            // Splice stream-copied samples with the rendered transitions
+            var outputPath = await Task.Run(() => {
+                var first = movies[0];
+                var result = new MP4Container.Movie { fileType = first.fileType, header = first.header };
+                var track = MP4Container.Track.CreateEmpty(tracks[0]);
+                for (var i = 0; i < assets.Length; ++i) {
+                    MP4Container.AppendSamples(tracks[i], track, heads[i], tails[i] - heads[i]);
+                    if (i < segments.Count)
+                        MP4Container.AppendSamples(MP4Container.Read(segments[i].path!).GetTrack(@"vide")!, track);
+                }
+                // Rendered transitions are encoded with their own parameter sets, which players only apply when in-band
+                MP4Container.InlineParameterSets(track);
+                result.tracks.Add(track);
+                var path = MediaRecorder.CreatePath(extension: Path.GetExtension(paths[0]), prefix: prefix);
+                MP4Container.Write(result, path);
+                return path;
+            });
+            return await MediaAsset.FromFile(outputPath);
+        }
+
+        private static async Task<MediaAsset> RenderTransition(
+            MediaAsset outgoing,
+            MP4Container.Movie movie,
+            MP4Container.Track track,
+            int tailStart,
+            MediaAsset incoming,
+            int headEnd,
+            Transition transition,
+            float duration,
+            MediaRecorder.Format format,
+            string? prefix
+        ) {
+            // Stream-copy the tail of the outgoing video into its own file, so that decoding starts at its keyframe
+            var tailPath = Path.Combine(Application.temporaryCachePath, $"transition_{Guid.NewGuid():N}.mp4");
+            await Task.Run(() => {
+                var tail = new MP4Container.Movie { fileType = movie.fileType, header = movie.header };
+                var tailTrack = MP4Container.Track.CreateEmpty(track);
+                MP4Container.AppendSamples(track, tailTrack, tailStart);
+                tail.tracks.Add(tailTrack);
+                MP4Container.Write(tail, tailPath);
+            });
+            var tailTimestamp = GetDecodeTimes(track)[tailStart] * 1_000_000_000L / track.timescale;
+            var transitionTimestamp = (long)((track.duration / (double)track.timescale - duration) * 1e+9);
+            var transitionDuration = (long)(duration * 1e+9);
+            var tolerance = (long)(0.5e+9 / Math.Max(outgoing.frameRate, 1f));
+            // Create recorder matching the bitrate and keyframe interval of the outgoing video
+            var (width, height) = (outgoing.width, outgoing.height);
+            var trackDuration = Math.Max(track.duration / (double)track.timescale, 1e-3);
+            var bitRate = track.samples.Sum(sample => (long)sample.size) * 8 / trackDuration;
+            var keyframeCount = track.samples.Count(sample => sample.sync);
+            var recorder = await MediaRecorder.Create(
+                format: format,
+                width: width,
+                height: height,
+                frameRate: outgoing.frameRate,
+                sampleRate: 0,
+                channelCount: 0,
+                videoBitRate: (int)Math.Clamp(bitRate, 500_000, 100_000_000),
+                keyframeInterval: Math.Max((int)Math.Round(trackDuration / Math.Max(keyframeCount, 1)), 1),
+                prefix: prefix
+            );
+            // Blend the tail of the outgoing video with the head of the incoming video
+            var frameSize = width * height * 4;
+            var data = new byte[2 * frameSize];
+            var handle = GCHandle.Alloc(data, GCHandleType.Pinned);
+            var dataPtr = handle.AddrOfPinnedObject();
+            var tailAsset = default(MediaAsset);
+            try {
+                tailAsset = await MediaAsset.FromFile(tailPath);
+                using var head = incoming.Read<PixelBuffer>().Take(headEnd).GetEnumerator();
+                var headValid = head.MoveNext();
+                var headStart = headValid ? head.Current.timestamp : 0L;
+                foreach (var srcBuffer in tailAsset.Read<PixelBuffer>()) {
+                    var timestamp = tailTimestamp + srcBuffer.timestamp;
+                    using var dstBuffer = Wrap(dataPtr, width, height, timestamp - tailTimestamp);
+                    srcBuffer.CopyTo(dstBuffer);
+                    if (timestamp < transitionTimestamp) {
+                        recorder.Append(dstBuffer);
+                        continue;
+                    }
+                    // Copy the incoming frame at the same time in the transition
+                    var headTimestamp = timestamp - transitionTimestamp;
+                    while (headValid && head.Current.timestamp - headStart <= headTimestamp + tolerance) {
+                        using (var headBuffer = Wrap(dataPtr + frameSize, width, height, 0L))
+                            head.Current.CopyTo(headBuffer);
+                        headValid = head.MoveNext();
+                    }
+                    // Blend
+                    var progress = Math.Clamp((float)headTimestamp / transitionDuration, 0f, 1f);
+                    var (weightOut, weightIn) = transition switch {
+                        Transition.Crossfade    => (1f - progress, progress),
+                        Transition.DipToBlack   => progress < 0.5f ? (1f - 2f * progress, 0f) : (0f, 2f * progress - 1f),
+                        _                       => (1f, 0f),
+                    };
+                    Blend(data.AsSpan(0, frameSize), data.AsSpan(frameSize, frameSize), weightOut, weightIn, data.AsSpan(0, frameSize));
+                    recorder.Append(dstBuffer);
+                }
+                // Copy the rest of the incoming video up to its first stream-copied keyframe
+                for (; headValid; headValid = head.MoveNext()) {
+                    using var dstBuffer = Wrap(
+                        dataPtr,
+                        width,
+                        height,
+                        transitionTimestamp - tailTimestamp + head.Current.timestamp - headStart
+                    );
+                    head.Current.CopyTo(dstBuffer);
+                    recorder.Append(dstBuffer);
+                }
+            } catch {
+                await MediaAsset.DiscardRecording(recorder);
+                throw;
+            } finally {
+                handle.Free();
+                tailAsset?.Release();
+                try { File.Delete(tailPath); }
+                catch (IOException) { } // deleted by the next concatenation once it is no longer in use
+            }
+            // Finish
+            return await recorder.FinishWriting();
+        }
+
+        private static MP4Container.Movie? TryRead(string path) {
+            try {
+                return MP4Container.Read(path);
+            } catch (Exception ex) when (ex is InvalidDataException || ex is EndOfStreamException) {
+                return null; // not an MP4 or MOV file, so it gets re-encoded
+            }
+        }
+
+        private static long[] GetDecodeTimes(MP4Container.Track track) {
+            var decodeTimes = new long[track.samples.Count];
+            for (var i = 1; i < decodeTimes.Length; ++i)
+                decodeTimes[i] = decodeTimes[i - 1] + track.samples[i - 1].duration;
+            return decodeTimes;
+        }
+
+        private static Vector<ushort> Blend(Vector<ushort> a, Vector<ushort> b, Vector<float> weightA, Vector<float> weightB) {
+            Vector.Widen(a, out var a0, out var a1);
+            Vector.Widen(b, out var b0, out var b1);
+            return Vector.Narrow(Blend(a0, b0, weightA, weightB), Blend(a1, b1, weightA, weightB));
+        }
+
+        private static Vector<uint> Blend(Vector<uint> a, Vector<uint> b, Vector<float> weightA, Vector<float> weightB) {
+            var fa = Vector.ConvertToSingle(Vector.AsVectorInt32(a));
+            var fb = Vector.ConvertToSingle(Vector.AsVectorInt32(b));
+            var result = fa * weightA + fb * weightB + new Vector<float>(0.5f);
+            return Vector.AsVectorUInt32(Vector.ConvertToInt32(result));
+        }
+
+        private static unsafe PixelBuffer Wrap(IntPtr handle, int width, int height, long timestamp) => new(
+            width: width,
+            height: height,
+            format: PixelBuffer.Format.RGBA8888,
+            data: (byte*)handle,
+            timestamp: timestamp
+        );
+        #endregion
+    }
+}
\ No newline at end of file
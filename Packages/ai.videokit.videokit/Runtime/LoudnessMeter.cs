@@ -0,0 +1,362 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+#nullable enable
+
+namespace VideoKit {
+
+    using System;
+    using System.Numerics;
+    using Unity.Collections.LowLevel.Unsafe;
+
+    /// <summary>
+    /// Loudness meter which measures audio loudness incrementally, following EBU R128 and ITU-R BS.1770.
+    /// Loudness values are in LUFS, and are negative infinity until enough audio has been measured.
+    /// All meter methods are thread safe, and as such can be called from any thread.
+    /// </summary>
+    public sealed class LoudnessMeter {
+
+        #region --Client API--
+        /// <summary>
+        /// Meter sample rate.
+        /// </summary>
+        public readonly int sampleRate;
+
+        /// <summary>
+        /// Meter channel count.
+        /// </summary>
+        public readonly int channelCount;
+
+        /// <summary>
+        /// Momentary loudness over the last 400ms, in LUFS.
+        /// </summary>
+        public float momentaryLoudness {
+            get {
+                lock (fence)
+                    return GetLoudness(GetPower(4));
+            }
+        }
+
+        /// <summary>
+        /// Short-term loudness over the last 3s, in LUFS.
+        /// </summary>
+        public float shortTermLoudness {
+            get {
+                lock (fence)
+                    return GetLoudness(GetPower(HopCount));
+            }
+        }
+
+        /// <summary>
+        /// Gated integrated loudness of all measured audio, in LUFS.
+        /// </summary>
+        public float integratedLoudness {
+            get {
+                lock (fence) {
+                    // Apply absolute gate
+                    var (power, count) = (0.0, 0L);
+                    for (var i = 0; i < histogramCounts.Length; ++i) {
+                        power += histogramPowers[i];
+                        count += histogramCounts[i];
+                    }
+                    if (count == 0)
+                        return float.NegativeInfinity;
+                    // Apply relative gate
+                    var gate = GetLoudness(power / count) - 10f;
+                    (power, count) = (0.0, 0L);
+                    for (var i = Math.Max(GetHistogramIndex(gate), 0); i < histogramCounts.Length; ++i) {
+                        power += histogramPowers[i];
+                        count += histogramCounts[i];
+                    }
+                    return count > 0 ? GetLoudness(power / count) : float.NegativeInfinity;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Maximum true peak of all measured audio, in dBTP.
+        /// The true peak is estimated by oversampling the audio by 4x.
+        /// </summary>
+        public float truePeak {
+            get {
+                lock (fence)
+                    return 20f * MathF.Log10(maxTruePeak);
+            }
+        }
+
+        /// <summary>
+        /// Maximum sample peak of all measured audio, in dBFS.
+        /// </summary>
+        public float samplePeak {
+            get {
+                lock (fence)
+                    return 20f * MathF.Log10(maxSamplePeak);
+            }
+        }
+
+        /// <summary>
+        /// Duration of measured audio in seconds.
+        /// </summary>
+        public float duration {
+            get {
+                lock (fence)
+                    return (float)frameCount / sampleRate;
+            }
+        }
+
+        /// <summary>
+        /// Create a loudness meter.
+        /// </summary>
+        /// <param name="sampleRate">Audio sample rate.</param>
+        /// <param name="channelCount">Audio channel count.</param>
+        public LoudnessMeter(int sampleRate, int channelCount) {
+            // Check
+            if (sampleRate <= 0 || channelCount <= 0)
+                throw new ArgumentException($"Cannot create loudness meter because format is invalid: {sampleRate}Hz {channelCount}ch");
+            // Create
+            this.sampleRate = sampleRate;
+            this.channelCount = channelCount;
+            this.hopFrames = Math.Max(sampleRate / 10, 1);
+            this.weights = new float[channelCount];
+            for (var c = 0; c < channelCount; ++c) // BS.1770 weights, ignoring LFE in 5.1
+                weights[c] = channelCount == 6 ? (c == 3 ? 0f : c >= 4 ? 1.41f : 1f) : 1f;
+            this.states = new double[channelCount, 4];
+            this.history = new float[channelCount, TapsPerPhase - 1];
+            this.hops = new double[HopCount];
+            this.histogramPowers = new double[HistogramSize];
+            this.histogramCounts = new long[HistogramSize];
+            this.scratch = Array.Empty<float>();
+            this.energy = Array.Empty<float>();
+            this.output = Array.Empty<float>();
+            // Compute K-weighting filters
+            var k = Math.Tan(Math.PI * 1681.974450955533 / sampleRate);
+            var vh = Math.Pow(10.0, 3.999843853973347 / 20.0);
+            var vb = Math.Pow(vh, 0.4996667741545416);
+            var q = 0.7071752369554196;
+            var a0 = 1.0 + k / q + k * k;
+            this.shelf = (
+                (vh + vb * k / q + k * k) / a0,
+                2.0 * (k * k - vh) / a0,
+                (vh - vb * k / q + k * k) / a0,
+                2.0 * (k * k - 1.0) / a0,
+                (1.0 - k / q + k * k) / a0
+            );
+            k = Math.Tan(Math.PI * 38.13547087602444 / sampleRate);
+            q = 0.5003270373238773;
+            a0 = 1.0 + k / q + k * k;
+            this.highpass = (1.0, -2.0, 1.0, 2.0 * (k * k - 1.0) / a0, (1.0 - k / q + k * k) / a0);
+        }
+
+        /// <summary>
+        /// Measure an audio buffer.
+        /// </summary>
+        /// <param name="audioBuffer">Audio buffer. This MUST have the same format as the meter.</param>
+        public unsafe void Append(AudioBuffer audioBuffer) {
+            // Check
+            if (audioBuffer.sampleRate != sampleRate || audioBuffer.channelCount != channelCount)
+                throw new ArgumentException($"Cannot measure audio buffer because format does not match meter: {audioBuffer.sampleRate}Hz {audioBuffer.channelCount}ch");
+            // Append
+            var data = audioBuffer.data;
+            Append(new ReadOnlySpan<float>(data.GetUnsafeReadOnlyPtr(), data.Length));
+        }
+
+        /// <summary>
+        /// Measure interleaved linear PCM audio.
+        /// </summary>
+        /// <param name="data">Interleaved audio samples with the same format as the meter.</param>
+        public void Append(ReadOnlySpan<float> data) {
+            var frames = data.Length / channelCount;
+            if (frames == 0)
+                return;
+            lock (fence) {
+                // Ensure buffers
+                if (energy.Length < frames) {
+                    scratch = new float[frames + TapsPerPhase - 1];
+                    energy = new float[frames];
+                    output = new float[frames];
+                }
+                Array.Clear(energy, 0, frames);
+                // Filter each channel
+                for (var c = 0; c < channelCount; ++c) {
+                    for (var i = 0; i < TapsPerPhase - 1; ++i)
+                        scratch[i] = history[c, i];
+                    for (var i = 0; i < frames; ++i)
+                        scratch[TapsPerPhase - 1 + i] = data[i * channelCount + c];
+                    for (var i = 0; i < TapsPerPhase - 1; ++i)
+                        history[c, i] = scratch[frames + i];
+                    MeasurePeaks(frames);
+                    if (weights[c] > 0f)
+                        ApplyKWeighting(c, frames);
+                }
+                // Accumulate gating blocks
+                for (var i = 0; i < frames; ++i) {
+                    hopPower += energy[i];
+                    if (++hopFrame < hopFrames)
+                        continue;
+                    hops[hopIndex++ % HopCount] = hopPower / hopFrames;
+                    hopPower = 0.0;
+                    hopFrame = 0;
+                    if (hopIndex >= 4)
+                        AddBlock(GetPower(4));
+                }
+                frameCount += frames;
+            }
+        }
+
+        /// <summary>
+        /// Reset the meter, discarding all measurements.
+        /// </summary>
+        public void Reset() {
+            lock (fence) {
+                Array.Clear(states, 0, states.Length);
+                Array.Clear(history, 0, history.Length);
+                Array.Clear(hops, 0, hops.Length);
+                Array.Clear(histogramPowers, 0, histogramPowers.Length);
+                Array.Clear(histogramCounts, 0, histogramCounts.Length);
+                hopIndex = 0;
+                hopFrame = 0;
+                hopPower = 0.0;
+                frameCount = 0L;
+                maxTruePeak = 0f;
+                maxSamplePeak = 0f;
+            }
+        }
+        #endregion
+
+
+        #region --Operations--
+        private readonly object fence = new();
+        private readonly int hopFrames;
+        private readonly float[] weights;
+        private readonly (double b0, double b1, double b2, double a1, double a2) shelf;
+        private readonly (double b0, double b1, double b2, double a1, double a2) highpass;
+        private readonly double[,] states;
+        private readonly float[,] history;
+        private readonly double[] hops;
+        private readonly double[] histogramPowers;
+        private readonly long[] histogramCounts;
+        private float[] scratch;
+        private float[] energy;
+        private float[] output;
+        private int hopIndex;
+        private int hopFrame;
+        private double hopPower;
+        private long frameCount;
+        private float maxTruePeak;
+        private float maxSamplePeak;
+        private const int HopCount = 30;            // 3s of 100ms hops
+        private const int HistogramSize = 1000;     // 0.1 LU bins from -70 LUFS
+        private const int TapsPerPhase = 12;
+        private static readonly float[][] Phases = CreatePhases();
+
+        private double GetPower(int count) {
+            if (hopIndex < count)
+                return 0.0;
+            var power = 0.0;
+            for (var i = 1; i <= count; ++i)
+                power += hops[(hopIndex - i) % HopCount];
+            return power / count;
+        }
+
+        private void AddBlock(double power) {
+            var loudness = GetLoudness(power);
+            if (loudness < -70f) // absolute gate
+                return;
+            var index = Math.Min(GetHistogramIndex(loudness), HistogramSize - 1);
+            histogramPowers[index] += power;
+            histogramCounts[index]++;
+        }
+
+        private void MeasurePeaks(int frames) {
+            // Sample peak
+            var vectorSize = Vector<float>.Count;
+            var peak = Vector<float>.Zero;
+            var i = 0;
+            for (; i + vectorSize <= frames; i += vectorSize)
+                peak = Vector.Max(peak, Vector.Abs(new Vector<float>(scratch, TapsPerPhase - 1 + i)));
+            var samplePeak = Max(peak);
+            for (; i < frames; ++i)
+                samplePeak = MathF.Max(samplePeak, MathF.Abs(scratch[TapsPerPhase - 1 + i]));
+            maxSamplePeak = MathF.Max(maxSamplePeak, samplePeak);
+            // True peak, with each polyphase filter vectorized across output samples
+            var truePeak = samplePeak;
+            foreach (var phase in Phases) {
+                Array.Clear(output, 0, frames);
+                for (var k = 0; k < TapsPerPhase; ++k) {
+                    var tap = phase[k];
+                    var coefficient = new Vector<float>(tap);
+                    var n = 0;
+                    for (; n + vectorSize <= frames; n += vectorSize)
+                        (new Vector<float>(output, n) + coefficient * new Vector<float>(scratch, n + k)).CopyTo(output, n);
+                    for (; n < frames; ++n)
+                        output[n] += tap * scratch[n + k];
+                }
+                peak = Vector<float>.Zero;
+                var j = 0;
+                for (; j + vectorSize <= frames; j += vectorSize)
+                    peak = Vector.Max(peak, Vector.Abs(new Vector<float>(output, j)));
+                truePeak = MathF.Max(truePeak, Max(peak));
+                for (; j < frames; ++j)
+                    truePeak = MathF.Max(truePeak, MathF.Abs(output[j]));
+            }
+            maxTruePeak = MathF.Max(maxTruePeak, truePeak);
+        }
+
+        private void ApplyKWeighting(int channel, int frames) {
+            // The biquads are recursive, so they run sample by sample
+            var (s0, s1, s2, s3) = (states[channel, 0], states[channel, 1], states[channel, 2], states[channel, 3]);
+            var weight = weights[channel];
+            for (var i = 0; i < frames; ++i) {
+                var x = (double)scratch[TapsPerPhase - 1 + i];
+                var y = shelf.b0 * x + s0;
+                s0 = shelf.b1 * x - shelf.a1 * y + s1;
+                s1 = shelf.b2 * x - shelf.a2 * y;
+                var z = highpass.b0 * y + s2;
+                s2 = highpass.b1 * y - highpass.a1 * z + s3;
+                s3 = highpass.b2 * y - highpass.a2 * z;
+                energy[i] += (float)(weight * z * z);
+            }
+            (states[channel, 0], states[channel, 1], states[channel, 2], states[channel, 3]) = (s0, s1, s2, s3);
+        }
+
+        private static float GetLoudness(double power) => power > 0.0 ?
+            -0.691f + 10f * (float)Math.Log10(power) :
+            float.NegativeInfinity;
+
+        private static int GetHistogramIndex(float loudness) => (int)MathF.Floor((loudness + 70f) * 10f);
+
+        private static float Max(Vector<float> vector) {
+            var result = 0f;
+            for (var i = 0; i < Vector<float>.Count; ++i)
+                result = MathF.Max(result, vector[i]);
+            return result;
+        }
+
+        private static float[][] CreatePhases() {
+            // Design a windowed sinc interpolation filter for 4x oversampling
+            const int Factor = 4;
+            const int Length = Factor * TapsPerPhase;
+            var filter = new double[Length];
+            for (var n = 0; n < Length; ++n) {
+                var t = (n - (Length - 1) / 2.0) / Factor;
+                var sinc = Math.Abs(t) < 1e-9 ? 1.0 : Math.Sin(Math.PI * t) / (Math.PI * t);
+                var window = 0.42 - 0.5 * Math.Cos(2.0 * Math.PI * (n + 0.5) / Length) + 0.08 * Math.Cos(4.0 * Math.PI * (n + 0.5) / Length);
+                filter[n] = sinc * window;
+            }
+            // Split into unity gain phases, with taps ordered oldest sample first
+            var phases = new float[Factor][];
+            for (var p = 0; p < Factor; ++p) {
+                phases[p] = new float[TapsPerPhase];
+                var sum = 0.0;
+                for (var j = 0; j < TapsPerPhase; ++j)
+                    sum += filter[Factor * j + p];
+                for (var j = 0; j < TapsPerPhase; ++j)
+                    phases[p][TapsPerPhase - 1 - j] = (float)(filter[Factor * j + p] / sum);
+            }
+            return phases;
+        }
+        #endregion
+    }
+}
\ No newline at end of file
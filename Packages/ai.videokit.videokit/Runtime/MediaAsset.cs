@@ -17,8 +17,10 @@ namespace VideoKit {
     using System.Runtime.Serialization;
     using System.Text;
     using System.Text.RegularExpressions;
+    using System.Threading;
     using System.Threading.Tasks;
     using UnityEngine;
+    using UnityEngine.Experimental.Rendering;
     using UnityEngine.Networking;
     using Muna;
     using Newtonsoft.Json;
@@ -118,6 +120,24 @@ namespace VideoKit {
             [EnumMember(Value = @"salma")]
             Salma = 8,
         }
+
+        /// <summary>
+        /// Transition between concatenated videos.
+        /// </summary>
+        public enum Transition : int {
+            /// <summary>
+            /// Hard cut.
+            /// </summary>
+            Cut = 0,
+            /// <summary>
+            /// Crossfade from one video to the next.
+            /// </summary>
+            Crossfade = 1,
+            /// <summary>
+            /// Fade out to black then fade in to the next video.
+            /// </summary>
+            DipToBlack = 2,
+        }
         #endregion
 
 
@@ -169,11 +189,23 @@ namespace VideoKit {
         /// </summary>
         public float duration => handle.GetMediaAssetDuration(out var duration) == Status.Ok ? duration : default;
 
+        /// <summary>
+        /// Integrated audio loudness in LUFS, from the loudness metadata written by `MediaRecorder`.
+        /// This is `null` if the asset has no loudness metadata.
+        /// </summary>
+        public float? loudness => this.path is string path && type != MediaType.Sequence ? MP4Container.ReadLoudness(path) : null;
+
         /// <summary>
         /// Media assets contained within this asset.
         /// This is only populated for `Sequence` assets.
         /// </summary>
         public IReadOnlyList<MediaAsset> assets => new NativeMediaSequence(this);
+
+        /// <summary>
+        /// Source video of a proxy created with `MediaAsset.CreateProxy`.
+        /// This is `null` for assets which are not proxies.
+        /// </summary>
+        public MediaAsset? proxySource { get; private set; }
         #endregion
 
 
@@ -372,6 +404,44 @@ namespace VideoKit {
             );
         }
 
+        /// <summary>
+        /// Create a media asset by concatenating a set of video assets with transitions between them.
+        /// Only the frames within each transition window, extended to the nearest keyframes, are decoded, blended, and re-encoded.
+        /// All other frames are copied without re-encoding, so export time grows with the number of transitions instead of the total duration.
+        /// Consecutive videos overlap by the transition duration.
+        /// Audio is not included in the concatenated video.
+        /// Videos which are not MP4 or MOV files encoded with the codec of the destination format are fully re-encoded first.
+        /// </summary>
+        /// <param name="assets">Video assets to concatenate.</param>
+        /// <param name="transition">Transition between consecutive videos.</param>
+        /// <param name="transitionDuration">Transition duration in seconds.</param>
+        /// <param name="format">Destination format for concatenated media asset.</param>
+        /// <param name="prefix">Subdirectory name to save recordings. This will be created if it does not exist.</param>
+        /// <returns>Concatenated media asset.</returns>
+        public static Task<MediaAsset> FromConcatenatingAssets(
+            MediaAsset[] assets,
+            Transition transition,
+            float transitionDuration = 0.5f,
+            MediaRecorder.Format format = MediaRecorder.Format.MP4,
+            string? prefix = null
+        ) {
+            // Check
+            if (assets.Length == 0)
+                throw new ArgumentException(@"Concatenate requires at least one media asset");
+            if (assets.Any(asset => asset.type != MediaType.Video))
+                throw new NotImplementedException(@"Concatenate with transitions only supports video assets");
+            var width = assets[0].width;
+            var height = assets[0].height;
+            if (assets.Any(asset => asset.width != width || asset.height != height))
+                throw new ArgumentException(@"Concatenate requires that all videos have the same resolution");
+            if (transitionDuration < 0f)
+                throw new ArgumentException($"Cannot concatenate with transitions because transition duration is negative: {transitionDuration}");
+            if (transition != Transition.Cut && assets.Any(asset => asset.duration <= transitionDuration))
+                throw new ArgumentException($"Cannot concatenate with transitions because a video is shorter than the transition duration: {transitionDuration}");
+            // Concatenate
+            return TransitionRenderer.Concatenate(assets, transition, transitionDuration, format, prefix);
+        }
+
         /// <summary>
         /// Create a media asset by performing text-to-speech on the provided text prompt.
         /// </summary>
@@ -405,10 +475,21 @@ namespace VideoKit {
         /// Create a media asset by transcribing on the provided audio clip.
         /// </summary>
         /// <param name="audio">Audio clip to transcribe.</param>
+        /// <param name="trimSilence">Whether to trim silence from the audio before it is transcribed.
+        /// This shortens uploads, but shifts the timeline of the transcribed audio.
+        /// When no speech is detected, an empty text asset is returned without transcribing.</param>
         /// <returns>Transcribed text asset.</returns>
-        public static async Task<MediaAsset> FromGeneratedTranscription(AudioClip audio) {
+        public static async Task<MediaAsset> FromGeneratedTranscription(
+            AudioClip audio,
+            bool trimSilence = false
+        ) {
             var audioAsset = await FromAudioClip(audio, MediaRecorder.Format.WAV);
-            var transcriptionAsset = await FromGeneratedTranscription(audioAsset.path);
+            if (trimSilence) {
+                audioAsset = await audioAsset.TrimSilence();
+                if (audioAsset.duration <= 0f)
+                    return await FromText(string.Empty);
+            }
+            var transcriptionAsset = await FromGeneratedTranscription(audioAsset.path!);
             return transcriptionAsset;
         }
 
@@ -521,6 +602,13 @@ namespace VideoKit {
         /// </summary>
         /// <returns>Sample buffers in the media asset.</returns>
         public IEnumerable<T> Read<T>() where T : struct {
+            if (typeof(T) == typeof(MetadataBuffer)) {
+                var path = this.path;
+                if (path != null && this.type != MediaType.Sequence)
+                    foreach (var metadataBuffer in MP4Container.ReadMetadata(path))
+                        yield return (T)(object)metadataBuffer;
+                yield break;
+            }
             var type = GetMediaType<T>();
             foreach (var sampleBuffer in Read(type)) {
                 if (type == MediaType.Video)
@@ -532,6 +620,87 @@ namespace VideoKit {
             }
         }
 
+        /// <summary>
+        /// Compute a waveform summary of the audio in the media asset.
+        /// Audio is decoded and reduced one buffer at a time, and the result is cached in a sidecar file
+        /// next to the asset so that subsequent calls skip decoding.
+        /// </summary>
+        /// <param name="bucketCount">Number of waveform buckets.</param>
+        /// <returns>Audio waveform.</returns>
+        public Task<AudioWaveform> ComputeWaveform(int bucketCount = 1024) {
+            // Check
+            if (bucketCount <= 0)
+                throw new ArgumentException($"Cannot compute waveform because bucket count is invalid: {bucketCount}");
+            var path = GetAudioPath(@"waveform");
+            // Compute
+            var frameCount = (long)Math.Ceiling(duration * sampleRate);
+            return Task.Run(() => ComputeCached(
+                path,
+                $"{bucketCount}.waveform",
+                stream => AudioWaveform.Read(stream, bucketCount),
+                (waveform, stream) => waveform.Write(stream),
+                () => AudioWaveform.Compute(Read<AudioBuffer>(), bucketCount, frameCount)
+            ));
+        }
+
+        /// <summary>
+        /// Compute a spectrogram of the audio in the media asset.
+        /// Audio is decoded and analyzed one buffer at a time, and the result is cached in a sidecar file
+        /// next to the asset so that subsequent calls skip decoding.
+        /// </summary>
+        /// <param name="fftSize">FFT size in samples. This MUST be a power of two.</param>
+        /// <param name="hopSize">Number of samples between successive frames. When this is larger than the FFT size, the samples between frames are skipped.</param>
+        /// <returns>Audio spectrogram.</returns>
+        public Task<AudioSpectrogram> ComputeSpectrogram(int fftSize = 1024, int hopSize = 512) {
+            // Check
+            if (fftSize < 2 || (fftSize & (fftSize - 1)) != 0)
+                throw new ArgumentException($"Cannot compute spectrogram because FFT size is not a power of two: {fftSize}");
+            if (hopSize <= 0)
+                throw new ArgumentException($"Cannot compute spectrogram because hop size is invalid: {hopSize}");
+            var path = GetAudioPath(@"spectrogram");
+            // Compute
+            return Task.Run(() => ComputeCached(
+                path,
+                $"{fftSize}_{hopSize}.spectrogram",
+                stream => AudioSpectrogram.Read(stream, fftSize, hopSize),
+                (spectrogram, stream) => spectrogram.Write(stream),
+                () => AudioSpectrogram.Compute(Read<AudioBuffer>(), fftSize, hopSize)
+            ));
+        }
+
+        /// <summary>
+        /// Detect scenes in the video asset.
+        /// Frames are compared using luma histograms and signatures computed on a subsampled grid,
+        /// and the best exposed, highest contrast frame in each scene is picked as its thumbnail.
+        /// </summary>
+        /// <param name="threshold">Frame difference in range [0, 1] above which a cut is detected.</param>
+        /// <param name="minSceneDuration">Minimum scene duration in seconds.</param>
+        /// <param name="analysisFrameRate">Maximum number of frames analyzed per second of video. Lower values are faster but can merge fast consecutive cuts.</param>
+        /// <param name="keyframesOnly">Whether to only decode keyframes, which are stream-copied into a temporary file without re-encoding.
+        /// This is much faster for long videos, but cuts are only located to the nearest keyframe and cuts between keyframes can be missed.
+        /// Videos which are not MP4 or MOV files are always fully decoded.</param>
+        /// <returns>Detected scenes, in order.</returns>
+        public Task<VideoScene[]> DetectScenes(
+            float threshold = 0.3f,
+            float minSceneDuration = 1f,
+            float analysisFrameRate = 10f,
+            bool keyframesOnly = false
+        ) {
+            // Check
+            if (type != MediaType.Video)
+                throw new InvalidOperationException($"Cannot detect scenes because media asset is not a video: {type}");
+            if (threshold <= 0f || threshold >= 1f)
+                throw new ArgumentException($"Cannot detect scenes because threshold is invalid: {threshold}");
+            if (analysisFrameRate <= 0f)
+                throw new ArgumentException($"Cannot detect scenes because analysis frame rate is invalid: {analysisFrameRate}");
+            // Detect
+            var (width, height, duration) = (this.width, this.height, this.duration);
+            var detector = new SceneDetector(width, height, threshold, minSceneDuration, 1f / analysisFrameRate);
+            if (keyframesOnly && path != null)
+                return DetectKeyframeScenes(detector);
+            return Task.Run(() => DetectScenes(detector, Read<PixelBuffer>(), duration));
+        }
+
         /// <summary>
         /// Parse the text asset into a structure.
         /// </summary>
@@ -722,6 +891,468 @@ namespace VideoKit {
                 timestamp: timestamp
             );
         }
+
+        /// <summary>
+        /// Create a time-lapse of the video asset.
+        /// When the video has frequent enough keyframes, only keyframes are kept and re-timed without decoding or re-encoding,
+        /// so the time-lapse is generated at the speed of copying the file.
+        /// Otherwise, the video is decoded and every few frames are re-encoded.
+        /// Audio is not included in the time-lapse.
+        /// </summary>
+        /// <param name="speed">Speed factor. For instance, a factor of 10 makes a 10 minute video play in 1 minute.</param>
+        /// <param name="format">Destination format for result media asset.</param>
+        /// <param name="prefix">Subdirectory name to save recordings. This will be created if it does not exist.</param>
+        /// <returns>Time-lapse media asset.</returns>
+        public async Task<MediaAsset> TimeLapse(
+            float speed,
+            MediaRecorder.Format format = MediaRecorder.Format.MP4,
+            string? prefix = null
+        ) {
+            // Check
+            if (type != MediaType.Video)
+                throw new ArgumentException(@"`MediaAsset.TimeLapse` can only be used on video assets");
+            if (speed <= 1f)
+                throw new ArgumentException($"Cannot create time-lapse because speed must be greater than one: {speed}");
+            // Copy keyframes
+            var sourcePath = this.path;
+            if (sourcePath != null && MP4Container.IsSupported(format)) {
+                var outputPath = await Task.Run(() => {
+                    var movie = MP4Container.Read(sourcePath);
+                    var video = movie.GetTrack(@"vide");
+                    if (video == null || !MP4Container.HasCodec(video, format))
+                        return null;
+                    var track = MP4Container.CreateTimeLapse(video, speed, 1.0 / MinTimeLapseFrameRate);
+                    if (track == null)
+                        return null;
+                    var timeLapse = new MP4Container.Movie { fileType = movie.fileType, header = movie.header };
+                    timeLapse.tracks.Add(track);
+                    var path = MediaRecorder.CreatePath(extension: Path.GetExtension(sourcePath), prefix: prefix);
+                    MP4Container.Write(timeLapse, path);
+                    return path;
+                });
+                if (outputPath != null)
+                    return await FromFile(outputPath);
+            }
+            // Create recorder
+            var frameRate = this.frameRate;
+            var recorder = await MediaRecorder.Create(
+                format: format,
+                width: width,
+                height: height,
+                frameRate: frameRate,
+                sampleRate: 0,
+                channelCount: 0,
+                prefix: prefix
+            );
+            // Decode and re-encode every few frames
+            var data = new byte[width * height * 4];
+            var handle = GCHandle.Alloc(data, GCHandleType.Pinned);
+            var dataPtr = handle.AddrOfPinnedObject();
+            var interval = (long)(speed * 1e+9 / Math.Max(frameRate, 1f));
+            var nextTimestamp = long.MinValue;
+            try {
+                foreach (var srcBuffer in Read<PixelBuffer>()) {
+                    var timestamp = srcBuffer.timestamp;
+                    if (timestamp < nextTimestamp)
+                        continue;
+                    nextTimestamp = nextTimestamp == long.MinValue ? timestamp + interval : nextTimestamp + interval;
+                    using var dstBuffer = Wrap(
+                        dataPtr,
+                        width,
+                        height,
+                        (long)(timestamp / speed)
+                    );
+                    srcBuffer.CopyTo(dstBuffer);
+                    recorder.Append(dstBuffer);
+                }
+            } catch {
+                await DiscardRecording(recorder);
+                throw;
+            } finally {
+                handle.Free();
+            }
+            // Finish
+            return await recorder.FinishWriting();
+            // Helper
+            static unsafe PixelBuffer Wrap(IntPtr handle, int width, int height, long timestamp) => new(
+                width: width,
+                height: height,
+                format: PixelBuffer.Format.RGBA8888,
+                data: (byte*)handle,
+                timestamp: timestamp
+            );
+        }
+
+        /// <summary>
+        /// Create a reversed copy of the video asset.
+        /// The video is processed one group of pictures at a time from the end, so memory use is bounded
+        /// by the longest keyframe interval instead of the clip length.
+        /// Audio is not included in the reversed video.
+        /// This can only be used on MP4 and MOV video assets.
+        /// </summary>
+        /// <param name="format">Destination format for result media asset.</param>
+        /// <param name="prefix">Subdirectory name to save recordings. This will be created if it does not exist.</param>
+        /// <returns>Reversed media asset.</returns>
+        public async Task<MediaAsset> Reverse(
+            MediaRecorder.Format format = MediaRecorder.Format.MP4,
+            string? prefix = null
+        ) {
+            // Check
+            if (type != MediaType.Video)
+                throw new ArgumentException(@"`MediaAsset.Reverse` can only be used on video assets");
+            var sourcePath = this.path;
+            var movie = sourcePath != null ? await Task.Run(() => MP4Container.Read(sourcePath)) : null;
+            var video = movie?.GetTrack(@"vide");
+            if (video == null || video.samples.Count == 0)
+                throw new NotImplementedException(@"`MediaAsset.Reverse` is only supported for MP4 and MOV video assets");
+            // Split into groups of pictures
+            var keyframes = Enumerable.Range(0, video.samples.Count).Where(i => video.samples[i].sync).DefaultIfEmpty(0).ToList();
+            if (keyframes[0] != 0)
+                keyframes.Insert(0, 0);
+            var decodeTimes = new long[video.samples.Count];
+            for (var i = 1; i < decodeTimes.Length; ++i)
+                decodeTimes[i] = decodeTimes[i - 1] + video.samples[i - 1].duration;
+            // Create recorder
+            var recorder = await MediaRecorder.Create(
+                format: format,
+                width: width,
+                height: height,
+                frameRate: frameRate,
+                sampleRate: 0,
+                channelCount: 0,
+                prefix: prefix
+            );
+            // Reverse each group of pictures from the end
+            DeleteTemporaryFiles(@"reverse_*.mp4");
+            var gopDirectory = Application.temporaryCachePath;
+            var gopName = Guid.NewGuid().ToString(@"N");
+            var frames = new List<PixelBufferPacket>();
+            var endTimestamp = default(long?);
+            try {
+                for (var g = keyframes.Count - 1; g >= 0; --g) {
+                    // Stream-copy the group of pictures into its own file
+                    var start = keyframes[g];
+                    var count = (g + 1 < keyframes.Count ? keyframes[g + 1] : video.samples.Count) - start;
+                    var gopPath = Path.Combine(gopDirectory, $"reverse_{gopName}_{g}.mp4");
+                    await Task.Run(() => {
+                        var gop = new MP4Container.Movie { fileType = movie!.fileType, header = movie.header };
+                        var track = MP4Container.Track.CreateEmpty(video);
+                        MP4Container.AppendSamples(video, track, start, count);
+                        gop.tracks.Add(track);
+                        MP4Container.Write(gop, gopPath);
+                    });
+                    // Decode
+                    var gopAsset = default(MediaAsset);
+                    try {
+                        gopAsset = await FromFile(gopPath);
+                        var startTimestamp = decodeTimes[start] * 1_000_000_000L / video.timescale;
+                        foreach (var srcBuffer in gopAsset.Read<PixelBuffer>()) {
+                            var packet = new PixelBufferPacket(width, height, startTimestamp + srcBuffer.timestamp);
+                            srcBuffer.CopyTo(packet.buffer);
+                            frames.Add(packet);
+                        }
+                    } finally {
+                        gopAsset?.Release();
+                        try { File.Delete(gopPath); }
+                        catch (IOException) { } // deleted by the next reverse once it is no longer in use
+                    }
+                    // Encode in reverse
+                    try {
+                        if (endTimestamp == null && frames.Count > 0)
+                            endTimestamp = frames.Max(frame => frame.buffer.timestamp);
+                        for (var i = frames.Count - 1; i >= 0; --i) {
+                            using var dstBuffer = new PixelBuffer(
+                                width,
+                                height,
+                                PixelBuffer.Format.RGBA8888,
+                                frames[i].buffer.data,
+                                timestamp: endTimestamp!.Value - frames[i].buffer.timestamp
+                            );
+                            recorder.Append(dstBuffer);
+                        }
+                    } finally {
+                        foreach (var frame in frames)
+                            frame.Dispose();
+                        frames.Clear();
+                    }
+                }
+            } catch {
+                await DiscardRecording(recorder);
+                throw;
+            } finally {
+                foreach (var frame in frames)
+                    frame.Dispose();
+            }
+            // Finish
+            return await recorder.FinishWriting();
+        }
+
+        /// <summary>
+        /// Create a video from the images in a sequence asset, like one recorded with the `JPEG` format.
+        /// Images are decoded in parallel on background threads and appended to the video in order.
+        /// All images must have the same resolution.
+        /// This can only be used on sequence assets.
+        /// </summary>
+        /// <param name="frameRate">Video frame rate.</param>
+        /// <param name="format">Destination format for result media asset.</param>
+        /// <param name="prefix">Subdirectory name to save recordings. This will be created if it does not exist.</param>
+        /// <returns>Video asset.</returns>
+        public async Task<MediaAsset> ToVideo(
+            float frameRate = 30f,
+            MediaRecorder.Format format = MediaRecorder.Format.MP4,
+            string? prefix = null
+        ) {
+            // Check
+            if (type != MediaType.Sequence)
+                throw new ArgumentException(@"`MediaAsset.ToVideo` can only be used on sequence assets");
+            if (frameRate <= 0f)
+                throw new ArgumentException($"Cannot create video because frame rate is invalid: {frameRate}");
+            var images = assets.OfType<MediaAsset>().Where(asset => asset.type == MediaType.Image).ToArray();
+            if (images.Length == 0)
+                throw new InvalidOperationException(@"Cannot create video because sequence asset does not contain any images");
+            var (width, height) = (images[0].width, images[0].height);
+            // Create recorder
+            var recorder = await MediaRecorder.Create(
+                format: format,
+                width: width,
+                height: height,
+                frameRate: frameRate,
+                sampleRate: 0,
+                channelCount: 0,
+                prefix: prefix
+            );
+            // Decode images in parallel, keeping a bounded window of frames in flight
+            var pending = new Queue<Task<PixelBufferPacket>>();
+            var capacity = 2 * Environment.ProcessorCount;
+            try {
+                for (var i = 0; i < images.Length || pending.Count > 0;) {
+                    if (i < images.Length && pending.Count < capacity) {
+                        var (image, timestamp) = (images[i], (long)(i++ * 1e+9 / frameRate));
+                        pending.Enqueue(Task.Run(() => Decode(image, width, height, timestamp)));
+                        continue;
+                    }
+                    using var packet = await pending.Dequeue();
+                    recorder.Append(packet.buffer);
+                }
+            } catch {
+                await DiscardRecording(recorder);
+                throw;
+            } finally {
+                foreach (var task in pending)
+                    try { (await task).Dispose(); }
+                    catch (Exception) { } // the first error has already been thrown
+            }
+            // Finish
+            return await recorder.FinishWriting();
+            // Helper
+            static PixelBufferPacket Decode(MediaAsset image, int width, int height, long timestamp) {
+                if (image.width != width || image.height != height)
+                    throw new InvalidOperationException($"Cannot create video because image resolution does not match the first image: {image.path}");
+                foreach (var pixelBuffer in image.Read<PixelBuffer>()) {
+                    var packet = new PixelBufferPacket(width, height, timestamp);
+                    pixelBuffer.CopyTo(packet.buffer);
+                    return packet;
+                }
+                throw new InvalidOperationException($"Cannot create video because image could not be decoded: {image.path}");
+            }
+        }
+
+        /// <summary>
+        /// Create a JPEG image sequence from the frames of the video asset.
+        /// Frames are decoded in order and encoded to JPEG in parallel on background threads.
+        /// This can only be used on video assets.
+        /// </summary>
+        /// <param name="compressionQuality">JPEG compression quality in range [0, 1].</param>
+        /// <param name="prefix">Subdirectory name to save recordings. This will be created if it does not exist.</param>
+        /// <returns>Sequence asset.</returns>
+        public async Task<MediaAsset> ToImageSequence(
+            float compressionQuality = 0.8f,
+            string? prefix = null
+        ) {
+            // Check
+            if (type != MediaType.Video)
+                throw new ArgumentException(@"`MediaAsset.ToImageSequence` can only be used on video assets");
+            // Create directory
+            var directory = MediaRecorder.CreatePath(prefix: prefix);
+            Directory.CreateDirectory(directory);
+            // Encode frames in parallel, keeping a bounded window of frames in flight
+            var (width, height) = (this.width, this.height);
+            var quality = (int)(Mathf.Clamp01(compressionQuality) * 100);
+            var pending = new Queue<Task>();
+            var capacity = 2 * Environment.ProcessorCount;
+            var index = 0;
+            try {
+                foreach (var pixelBuffer in Read<PixelBuffer>()) {
+                    var packet = new PixelBufferPacket(width, height, pixelBuffer.timestamp);
+                    pixelBuffer.CopyTo(packet.buffer);
+                    var imagePath = Path.Combine(directory, $"{index++:D6}.jpg");
+                    pending.Enqueue(Task.Run(() => Encode(packet, width, height, quality, imagePath)));
+                    if (pending.Count >= capacity)
+                        await pending.Dequeue();
+                }
+                await Task.WhenAll(pending);
+            } catch {
+                // Discard the partial image sequence once in-flight frames are written
+                try { await Task.WhenAll(pending); }
+                catch (Exception) { } // the first error has already been thrown
+                try { Directory.Delete(directory, true); }
+                catch (IOException) { }
+                throw;
+            }
+            // Return
+            return await FromFile(directory);
+            // Helper
+            static void Encode(PixelBufferPacket packet, int width, int height, int quality, string path) {
+                try {
+                    // Flip, since image conversion expects rows from bottom to top
+                    var rowSize = width * 4;
+                    var row = new byte[rowSize];
+                    for (int top = 0, bottom = height - 1; top < bottom; ++top, --bottom) {
+                        Buffer.BlockCopy(packet.data, top * rowSize, row, 0, rowSize);
+                        Buffer.BlockCopy(packet.data, bottom * rowSize, packet.data, top * rowSize, rowSize);
+                        Buffer.BlockCopy(row, 0, packet.data, bottom * rowSize, rowSize);
+                    }
+                    // Encode
+                    var jpeg = ImageConversion.EncodeArrayToJPG(
+                        packet.data,
+                        GraphicsFormat.R8G8B8A8_UNorm,
+                        (uint)width,
+                        (uint)height,
+                        (uint)rowSize,
+                        quality
+                    );
+                    File.WriteAllBytes(path, jpeg);
+                } finally {
+                    packet.Dispose();
+                }
+            }
+        }
+
+        /// <summary>
+        /// Create a low resolution proxy of the video asset, for scrubbing and timeline previews in editors.
+        /// Frames are downscaled as they are decoded, directly from the decoded planes, and encoded on a background thread.
+        /// The proxy keeps the timestamps of the source video, so any time in the proxy maps to the same time in the source.
+        /// Proxies are cached next to the source video, so subsequent calls return the existing proxy.
+        /// Audio is not included in the proxy.
+        /// </summary>
+        /// <param name="maxHeight">Maximum proxy height. The source aspect ratio is preserved.</param>
+        /// <param name="shortGop">Whether the proxy should have short groups of pictures, so that seeking decodes few frames.
+        /// This uses ProRes where supported, in which every frame is a keyframe, and otherwise inserts a keyframe every second
+        /// instead of every two seconds.</param>
+        /// <param name="progress">Optional progress handler, invoked on a background thread with the fraction of the video processed.</param>
+        /// <returns>Proxy video asset.</returns>
+        public async Task<MediaAsset> CreateProxy(
+            int maxHeight = 360,
+            bool shortGop = true,
+            Action<float>? progress = null
+        ) {
+            // Check
+            if (type != MediaType.Video)
+                throw new ArgumentException(@"`MediaAsset.CreateProxy` can only be used on video assets");
+            if (maxHeight < 2)
+                throw new ArgumentException($"Cannot create proxy because maximum height is invalid: {maxHeight}");
+            var sourcePath = this.path;
+            if (sourcePath == null)
+                throw new InvalidOperationException(@"Cannot create proxy because video asset does not have a valid file path");
+            // Check for cached proxy
+            var format = shortGop && MediaRecorder.IsFormatSupported(MediaRecorder.Format.ProRes4444) ?
+                MediaRecorder.Format.ProRes4444 :
+                MediaRecorder.Format.MP4;
+            var extension = format == MediaRecorder.Format.ProRes4444 ? @".mov" : @".mp4";
+            var proxyPath = $"{sourcePath}.proxy{maxHeight}{(shortGop ? @"s" : string.Empty)}{extension}";
+            if (File.Exists(proxyPath) && File.GetLastWriteTimeUtc(proxyPath) >= File.GetLastWriteTimeUtc(sourcePath)) {
+                var cached = await FromFile(proxyPath);
+                cached.proxySource = this;
+                progress?.Invoke(1f);
+                return cached;
+            }
+            // Create recorder
+            var scale = Math.Min(1f, (float)maxHeight / height);
+            var proxyWidth = Math.Max((int)(width * scale) & ~1, 2);
+            var proxyHeight = Math.Max((int)(height * scale) & ~1, 2);
+            var recorder = await MediaRecorder.Create(
+                format: format,
+                width: proxyWidth,
+                height: proxyHeight,
+                frameRate: frameRate,
+                sampleRate: 0,
+                channelCount: 0,
+                keyframeInterval: shortGop ? 1 : 2
+            );
+            // Downscale and encode on a background thread
+            var duration = Math.Max((long)(this.duration * 1e+9), 1L);
+            try {
+                await Task.Run(() => {
+                    var downscaler = new PixelBufferDownscaler(width, height, proxyWidth, proxyHeight);
+                    var packet = new PixelBufferPacket(proxyWidth, proxyHeight, 0L);
+                    try {
+                        foreach (var pixelBuffer in Read<PixelBuffer>()) {
+                            downscaler.Downscale(pixelBuffer, packet.data);
+                            using var proxyBuffer = new PixelBuffer(
+                                proxyWidth,
+                                proxyHeight,
+                                PixelBuffer.Format.RGBA8888,
+                                packet.buffer.data,
+                                timestamp: pixelBuffer.timestamp
+                            );
+                            recorder.Append(proxyBuffer);
+                            progress?.Invoke(Mathf.Clamp01((float)pixelBuffer.timestamp / duration));
+                        }
+                    } finally {
+                        packet.Dispose();
+                    }
+                });
+            } catch {
+                await DiscardRecording(recorder);
+                throw;
+            }
+            var recording = await recorder.FinishWriting();
+            var recordingPath = recording.path!;
+            recording.Release();
+            // Cache next to the source, ignoring read-only locations
+            try {
+                if (File.Exists(proxyPath))
+                    File.Delete(proxyPath);
+                File.Move(recordingPath, proxyPath);
+                recordingPath = proxyPath;
+            } catch (IOException) {
+            } catch (UnauthorizedAccessException) { }
+            var proxy = await FromFile(recordingPath);
+            proxy.proxySource = this;
+            progress?.Invoke(1f);
+            return proxy;
+        }
+
+        /// <summary>
+        /// Remove silence from an audio asset, keeping only the audio which contains speech.
+        /// The result is a WAV audio asset.
+        /// This can only be used on audio assets.
+        /// </summary>
+        /// <param name="padding">Duration in seconds of audio to keep before and after speech.</param>
+        /// <param name="prefix">Subdirectory name to save recordings. This will be created if it does not exist.</param>
+        /// <returns>Result media asset.</returns>
+        public async Task<MediaAsset> TrimSilence(
+            float padding = 0.2f,
+            string? prefix = null
+        ) {
+            // Check type
+            if (type != MediaType.Audio)
+                throw new ArgumentException(@"`MediaAsset.TrimSilence` can only be used on audio assets");
+            // Create recorder
+            var recorder = await MediaRecorder.Create(
+                format: MediaRecorder.Format.WAV,
+                sampleRate: sampleRate,
+                channelCount: channelCount,
+                prefix: prefix
+            );
+            // Copy speech
+            var detector = new VoiceActivityDetector(sampleRate, channelCount) { hangover = padding };
+            var gate = detector.CreateGate(recorder.Append, padding);
+            foreach (var audioBuffer in Read<AudioBuffer>())
+                gate(audioBuffer);
+            // Finish
+            return await recorder.FinishWriting();
+        }
         #endregion
 
 
@@ -793,15 +1424,104 @@ namespace VideoKit {
             
         };
         internal const string TranscribeTag = @"@videokit/transcribe-v1";
+        private const double MinTimeLapseFrameRate = 10.0;
+        private static readonly TimeSpan TemporaryFileLifetime = TimeSpan.FromHours(1);
+        private int released;
 
         internal MediaAsset(IntPtr handle, MediaAsset? parent = null) {
             this.handle = handle;
             this.parent = parent;
         }
 
-        ~MediaAsset() {
-            if (parent == null)
-                handle.ReleaseMediaAsset();
+        ~MediaAsset() => Release();
+
+        /// <summary>
+        /// Release the native media asset, so that its file is no longer open and can be deleted.
+        /// The media asset MUST NOT be used afterwards.
+        /// </summary>
+        internal void Release() {
+            if (parent != null || Interlocked.Exchange(ref released, 1) != 0)
+                return;
+            handle.ReleaseMediaAsset();
+            GC.SuppressFinalize(this);
+        }
+
+        private async Task<VideoScene[]> DetectKeyframeScenes(SceneDetector detector) {
+            // Stream-copy keyframes into their own file
+            DeleteTemporaryFiles(@"scenes_*.mp4");
+            var sourcePath = path!;
+            var keyframePath = Path.Combine(Application.temporaryCachePath, $"scenes_{Guid.NewGuid():N}.mp4");
+            var copied = await Task.Run(() => {
+                MP4Container.Movie movie;
+                try {
+                    movie = MP4Container.Read(sourcePath);
+                } catch (InvalidDataException) {
+                    return false;
+                }
+                var video = movie.GetTrack(@"vide");
+                var track = video != null ? MP4Container.CreateKeyframeTrack(video) : null;
+                if (track == null)
+                    return false;
+                var keyframes = new MP4Container.Movie { fileType = movie.fileType, header = movie.header };
+                keyframes.tracks.Add(track);
+                MP4Container.Write(keyframes, keyframePath);
+                return true;
+            });
+            // Decode the whole video when keyframes cannot be copied
+            if (!copied)
+                return await Task.Run(() => DetectScenes(detector, Read<PixelBuffer>(), duration));
+            // Detect
+            var keyframeAsset = default(MediaAsset);
+            try {
+                keyframeAsset = await FromFile(keyframePath);
+                var frames = keyframeAsset.Read<PixelBuffer>();
+                return await Task.Run(() => DetectScenes(detector, frames, duration));
+            } finally {
+                keyframeAsset?.Release();
+                try { File.Delete(keyframePath); }
+                catch (IOException) { } // deleted by the next detection once it is no longer in use
+            }
+        }
+
+        private static VideoScene[] DetectScenes(SceneDetector detector, IEnumerable<PixelBuffer> frames, float duration) {
+            foreach (var pixelBuffer in frames)
+                detector.Process(pixelBuffer);
+            return detector.Finish(duration);
+        }
+
+        /// <summary>
+        /// Finish a recorder whose recording failed, and delete its partial output.
+        /// </summary>
+        /// <param name="recorder">Media recorder.</param>
+        internal static async Task DiscardRecording(MediaRecorder recorder) {
+            try {
+                var asset = await recorder.FinishWriting();
+                asset.Release();
+                if (Directory.Exists(asset.path))
+                    Directory.Delete(asset.path, true);
+                else if (asset.path != null)
+                    File.Delete(asset.path);
+            } catch (Exception ex) { // the original error is more useful, so don't replace it
+                Debug.LogWarning($"VideoKit: Failed to discard partial recording: {ex.Message}");
+            }
+        }
+
+        /// <summary>
+        /// Delete temporary files left behind by previous operations, like files which were still open when the operation finished.
+        /// Only files older than an hour are deleted, so that the files of concurrent operations are not affected.
+        /// </summary>
+        /// <param name="pattern">Temporary file name pattern.</param>
+        internal static void DeleteTemporaryFiles(string pattern) {
+            var now = DateTime.UtcNow;
+            try {
+                foreach (var file in new DirectoryInfo(Application.temporaryCachePath).EnumerateFiles(pattern))
+                    try {
+                        if (now - file.LastWriteTimeUtc > TemporaryFileLifetime)
+                            file.Delete();
+                    } catch (IOException) {
+                    } catch (UnauthorizedAccessException) { }
+            } catch (IOException) {
+            } catch (UnauthorizedAccessException) { }
         }
 
         private IEnumerable<IntPtr> Read(MediaType type) {
@@ -821,6 +1541,43 @@ namespace VideoKit {
             }
         }
 
+        private string GetAudioPath(string operation) {
+            var path = this.path;
+            if (type == MediaType.Sequence || path == null)
+                throw new InvalidOperationException($"Cannot compute {operation} because sequence assets do not have audio");
+            if (sampleRate <= 0 || channelCount <= 0)
+                throw new InvalidOperationException($"Cannot compute {operation} because media asset has no audio: {path}");
+            return path;
+        }
+
+        private static T ComputeCached<T>(
+            string path,
+            string extension,
+            Func<Stream, T?> read,
+            Action<T, Stream> write,
+            Func<T> compute
+        ) where T : class {
+            // Read sidecar, as long as it is newer than the asset
+            var cachePath = $"{path}.{extension}";
+            try {
+                if (File.Exists(cachePath) && File.GetLastWriteTimeUtc(cachePath) >= File.GetLastWriteTimeUtc(path)) {
+                    using var stream = File.OpenRead(cachePath);
+                    if (read(stream) is T cached)
+                        return cached;
+                }
+            } catch (IOException) {
+            } catch (UnauthorizedAccessException) { }
+            // Compute
+            var result = compute();
+            // Write sidecar, ignoring read-only locations
+            try {
+                using var stream = File.Create(cachePath);
+                write(result, stream);
+            } catch (IOException) {
+            } catch (UnauthorizedAccessException) { }
+            return result;
+        }
+
         public static implicit operator IntPtr(MediaAsset asset) => asset.handle;
         #endregion
 
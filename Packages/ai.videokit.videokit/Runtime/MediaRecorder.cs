@@ -9,9 +9,14 @@ namespace VideoKit {
 
     using AOT;
     using System;
+    using System.Buffers;
+    using System.Collections.Generic;
     using System.IO;
+    using System.Linq;
     using System.Runtime.InteropServices;
+    using System.Threading;
     using System.Threading.Tasks;
+    using Unity.Collections;
     using UnityEngine;
     using Internal;
     using Status = Internal.VideoKit.Status;
@@ -99,12 +104,12 @@ namespace VideoKit {
         /// <summary>
         /// Recorder audio sample rate.
         /// </summary>
-        public virtual int sampleRate => handle.GetMediaRecorderSampleRate(out var sampleRate).Throw() == Status.Ok ? sampleRate : default;
+        public virtual int sampleRate => audioSegment.handle.GetMediaRecorderSampleRate(out var sampleRate).Throw() == Status.Ok ? sampleRate : default;
 
         /// <summary>
         /// Recorder audio channel count.
         /// </summary>
-        public virtual int channelCount => handle.GetMediaRecorderChannelCount(out var channelCount).Throw() == Status.Ok ? channelCount : default;
+        public virtual int channelCount => audioSegment.handle.GetMediaRecorderChannelCount(out var channelCount).Throw() == Status.Ok ? channelCount : default;
 
         /// <summary>
         /// Whether the recorder supports appending pixel buffers.
@@ -114,34 +119,235 @@ namespace VideoKit {
         /// <summary>
         /// Whether the recorder supports appendind audio buffers.
         /// </summary>
-        public virtual bool canAppendAudioBuffer => handle.CanAppendAudioBuffer(out var result).Throw() == Status.Ok && result;
+        public virtual bool canAppendAudioBuffer => audioSegment.handle.CanAppendAudioBuffer(out var result).Throw() == Status.Ok && result;
+
+        /// <summary>
+        /// Video display rotation.
+        /// Pixel buffers are encoded as-is and this rotation is written to the container for players to apply.
+        /// NOTE: This is only supported by the `MP4`, `HEVC`, `AV1`, and `ProRes4444` formats.
+        /// </summary>
+        public virtual PixelBuffer.Rotation rotation {
+            get => displayRotation;
+            set {
+                if (value != PixelBuffer.Rotation._0 && !MP4Container.IsSupported(format))
+                    throw new InvalidOperationException($"Cannot set rotation because recording format does not support display transforms: {format}");
+                displayRotation = value;
+            }
+        }
+
+        /// <summary>
+        /// Whether the video should be horizontally mirrored on display.
+        /// Mirroring is applied before the display `rotation`.
+        /// NOTE: This is only supported by the `MP4`, `HEVC`, `AV1`, and `ProRes4444` formats.
+        /// </summary>
+        public virtual bool mirrored {
+            get => displayMirrored;
+            set {
+                if (value && !MP4Container.IsSupported(format))
+                    throw new InvalidOperationException($"Cannot set mirroring because recording format does not support display transforms: {format}");
+                displayMirrored = value;
+            }
+        }
+
+        /// <summary>
+        /// Optional loudness meter which measures audio buffers as they are appended, after the `limiter`.
+        /// When set, the integrated loudness and peaks are written to the audio track when writing is finished,
+        /// so that playback can be normalized without decoding.
+        /// The meter MUST have the same format as appended audio buffers.
+        /// NOTE: Loudness metadata is only written by the `MP4`, `HEVC`, `AV1`, and `ProRes4444` formats.
+        /// </summary>
+        public virtual LoudnessMeter? loudness { get; set; }
+
+        /// <summary>
+        /// Optional limiter applied to audio buffers before they are measured and encoded.
+        /// The limiter MUST have the same format as appended audio buffers.
+        /// </summary>
+        public virtual AudioLimiter? limiter { get; set; }
 
         /// <summary>
         /// Append a video frame to the recorder.
         /// </summary>
         /// <param name="image">Input image to append. The image MUST have a valid timestamp for formats that require one.</param>
-        public virtual void Append(PixelBuffer pixelBuffer) => handle.AppendPixelBuffer(pixelBuffer).Throw();
+        public virtual void Append(PixelBuffer pixelBuffer) {
+            // Split once the next segment is ready
+            var split = splitCompletion != null && (nextSegment?.IsCompleted ?? true) ? StartSplit() : null;
+            // Append
+            var segment = Acquire(ref videoSegment);
+            try {
+                segment.empty = false;
+                Interlocked.CompareExchange(ref segment.timestamp, pixelBuffer.timestamp, -1L);
+                Interlocked.CompareExchange(ref startTimestamp, pixelBuffer.timestamp, -1L);
+                segment.handle.AppendPixelBuffer(pixelBuffer).Throw();
+                split?.TrySetResult(pixelBuffer.timestamp);
+            } catch (Exception ex) {
+                split?.TrySetException(ex);
+                throw;
+            } finally {
+                Interlocked.Decrement(ref segment.pending);
+            }
+        }
 
         /// <summary>
         /// Append an audio frame to the recorder.
         /// </summary>
         /// <param name="audioBuffer">Input audio buffer to append. This audio buffer MUST have a valid timestamp for formats that require one.</param>
-        public virtual void Append(AudioBuffer audioBuffer) => handle.AppendSampleBuffer(audioBuffer).Throw();
+        public virtual unsafe void Append(AudioBuffer audioBuffer) {
+            // Check
+            var (limiter, meter) = (this.limiter, loudness);
+            var sampleRate = audioBuffer.sampleRate;
+            var channelCount = audioBuffer.channelCount;
+            if (limiter != null && (limiter.sampleRate != sampleRate || limiter.channelCount != channelCount))
+                throw new ArgumentException($"Cannot append audio buffer because format does not match limiter: {sampleRate}Hz {channelCount}ch");
+            if (meter != null && (meter.sampleRate != sampleRate || meter.channelCount != channelCount))
+                throw new ArgumentException($"Cannot append audio buffer because format does not match loudness meter: {sampleRate}Hz {channelCount}ch");
+            Interlocked.CompareExchange(ref startTimestamp, audioBuffer.timestamp, -1L);
+            // Append directly
+            if (limiter == null) {
+                AppendSampleBuffer(audioBuffer);
+                if (meter != null)
+                    lock (meter)
+                        meter.Append(audioBuffer);
+                return;
+            }
+            // Limit a copy, so that the caller's audio is untouched
+            var data = audioBuffer.data;
+            var samples = ArrayPool<float>.Shared.Rent(data.Length);
+            try {
+                NativeArray<float>.Copy(data, samples, data.Length);
+                lock (limiter)
+                    limiter.Process(samples.AsSpan(0, data.Length));
+                fixed (float* limitedData = samples)
+                    using (var limitedBuffer = new AudioBuffer(sampleRate, channelCount, limitedData, data.Length, audioBuffer.timestamp))
+                        AppendSampleBuffer(limitedBuffer);
+                if (meter != null)
+                    lock (meter)
+                        meter.Append(samples.AsSpan(0, data.Length));
+            } finally {
+                ArrayPool<float>.Shared.Return(samples);
+            }
+        }
+
+        /// <summary>
+        /// Append a metadata buffer to the recorder.
+        /// Metadata buffers are written to a timed metadata track, so they can be read back
+        /// with `MediaAsset.Read&lt;MetadataBuffer&gt;` without decoding any video.
+        /// NOTE: This is only supported by the `MP4`, `HEVC`, `AV1`, and `ProRes4444` formats.
+        /// </summary>
+        /// <param name="metadataBuffer">Metadata buffer to append. This metadata buffer MUST have a valid timestamp.</param>
+        public virtual void Append(MetadataBuffer metadataBuffer) {
+            // Check
+            if (!MP4Container.IsSupported(format))
+                throw new InvalidOperationException($"Cannot append metadata buffer because recording format does not support metadata: {format}");
+            // Spill to file, so that memory use does not grow with the recording
+            lock (metadata) {
+                metadataStream ??= new FileStream(Path.ChangeExtension(path!, @".metadata"), FileMode.Create, FileAccess.Write, FileShare.Read, 1 << 16);
+                var offset = metadataStream.Position;
+                metadataStream.Write(metadataBuffer.data, 0, metadataBuffer.data.Length);
+                metadata.Add((metadataBuffer.timestamp, offset, metadataBuffer.data.Length));
+            }
+        }
+
+        /// <summary>
+        /// Reconfigure the video encoder without stopping the recording.
+        /// Subsequent frames are encoded with the new size and bit rate into a new video segment,
+        /// and all segments are stream-copied into a single file when writing is finished.
+        /// Audio is encoded continuously across segments, so there are no gaps at the joins.
+        /// A pending split requested with `RequestSplit` is fulfilled by the new segment.
+        /// NOTE: This is only supported by the `MP4`, `HEVC`, `AV1`, and `ProRes4444` formats.
+        /// </summary>
+        /// <param name="width">Video width.</param>
+        /// <param name="height">Video height.</param>
+        /// <param name="videoBitRate">Video bit rate in bits per second. Pass zero to keep the current bit rate.</param>
+        public virtual void Reconfigure(
+            int width,
+            int height,
+            int videoBitRate = 0
+        ) {
+            // Check
+            if (factory == null)
+                throw new InvalidOperationException($"Cannot reconfigure recorder because recording format does not support reconfiguration: {format}");
+            if (width <= 0 || height <= 0)
+                throw new ArgumentException($"Cannot reconfigure recorder because size is invalid: {width}x{height}");
+            // Start new segment
+            lock (fence) {
+                DiscardNextSegment();
+                this.videoBitRate = videoBitRate > 0 ? videoBitRate : this.videoBitRate;
+                SwitchSegment(CreateSegment(width, height, this.videoBitRate));
+            }
+        }
+
+        /// <summary>
+        /// Request that the recording be split into a new video segment.
+        /// The native encoders cannot be forced to emit a keyframe, so a split closes the current video encoder
+        /// and starts a new one writing to a separate file, whose first frame is a keyframe.
+        /// All segments are stream-copied into a single file when writing is finished.
+        /// Splits are asynchronous: the encoder for the next segment is created in the background, and the split
+        /// happens on the first video frame appended once that encoder is ready. Frames appended in the meantime
+        /// are encoded into the current segment.
+        /// Requests made before the split happens are coalesced into a single split.
+        /// When the current segment has no video frames yet, its first frame already starts a segment, so no encoder is created.
+        /// NOTE: This is only supported by the `MP4`, `HEVC`, `AV1`, and `ProRes4444` formats.
+        /// </summary>
+        /// <returns>Timestamp of the first video frame in the new segment.</returns>
+        public virtual Task<long> RequestSplit() {
+            // Check
+            if (factory == null)
+                throw new InvalidOperationException($"Cannot request split because recording format does not support it: {format}");
+            // Create the next segment in the background
+            lock (fence) {
+                if (splitCompletion != null)
+                    return splitCompletion.Task;
+                splitCompletion = new TaskCompletionSource<long>(TaskCreationOptions.RunContinuationsAsynchronously);
+                if (Interlocked.Read(ref videoSegment.timestamp) >= 0) {
+                    var (width, height, videoBitRate) = (this.width, this.height, this.videoBitRate);
+                    nextSegment = Task.Run(() => CreateSegment(width, height, videoBitRate));
+                }
+                return splitCompletion.Task;
+            }
+        }
 
         /// <summary>
         /// Finish writing.
         /// </summary>
         /// <returns>Recorded media asset.</returns>
         public virtual Task<MediaAsset> FinishWriting() {
-            var tcs = new TaskCompletionSource<MediaAsset>();
-            var handle = GCHandle.Alloc(tcs, GCHandleType.Normal);
-            try {
-                this.handle.FinishWriting(OnFinishWriting, (IntPtr)handle).Throw();
-            } catch (Exception ex) {
-                handle.Free();
-                tcs.SetException(ex);
+            Task<MediaAsset> task;
+            lock (fence) {
+                // Finish segments
+                DiscardNextSegment();
+                splitCompletion?.TrySetCanceled();
+                splitCompletion = null;
+                if (videoSegment != audioSegment)
+                    FinishSegment(videoSegment);
+                audioSegment.Drain();
+                if (segments.Count == 0)
+                    task = FinishWriting(audioSegment.handle);
+                else {
+                    if (!audioSegment.empty)
+                        segments.Insert(0, (FinishWriting(audioSegment.handle), Interlocked.Read(ref audioSegment.timestamp)));
+                    else
+                        discards.Add(DiscardSegment(audioSegment.handle, path!));
+                    task = ConcatenateSegments(segments.ToArray(), discards.ToArray(), path!);
+                }
+                lock (metadata)
+                    if (metadataStream != null) {
+                        var metadataPath = metadataStream.Name;
+                        var buffers = metadata.OrderBy(buffer => buffer.timestamp).ToArray();
+                        metadataStream.Dispose();
+                        metadataStream = null;
+                        task = AddMetadataTrack(task, metadataPath, buffers, startTimestamp >= 0 ? startTimestamp : buffers[0].timestamp);
+                    }
+                var meter = loudness;
+                if (meter != null && MP4Container.IsSupported(format))
+                    lock (meter) {
+                        var integratedLoudness = meter.integratedLoudness;
+                        if (!float.IsNegativeInfinity(integratedLoudness))
+                            task = WriteLoudness(task, integratedLoudness, meter.truePeak, meter.samplePeak);
+                    }
             }
-            return tcs.Task;
+            return displayRotation != PixelBuffer.Rotation._0 || displayMirrored ?
+                ApplyDisplayTransform(task, displayRotation, displayMirrored) :
+                task;
         }
 
         /// <summary>
@@ -178,30 +384,42 @@ namespace VideoKit {
             // Create recorder
             IntPtr recorder = IntPtr.Zero;
             switch (format) {
-                case Format.MP4: return new MediaRecorder(VideoKit.CreateMP4Recorder(
-                        CreatePath(extension:@".mp4", prefix:prefix),
+                case Format.MP4: return new MediaRecorder(
+                    CreatePath(extension: @".mp4", prefix: prefix),
+                    width,
+                    height,
+                    videoBitRate,
+                    (path, width, height, videoBitRate, audio) => VideoKit.CreateMP4Recorder(
+                        path,
                         width,
                         height,
                         frameRate,
-                        sampleRate,
-                        channelCount,
+                        audio ? sampleRate : 0,
+                        audio ? channelCount : 0,
                         videoBitRate,
                         keyframeInterval,
                         audioBitRate,
-                        out recorder
-                    ).Throw() == Status.Ok ? recorder : default);
-                case Format.HEVC: return new MediaRecorder(VideoKit.CreateHEVCRecorder(
-                        CreatePath(extension: @".mp4", prefix: prefix),
+                        out var recorder
+                    ).Throw() == Status.Ok ? recorder : default
+                );
+                case Format.HEVC: return new MediaRecorder(
+                    CreatePath(extension: @".mp4", prefix: prefix),
+                    width,
+                    height,
+                    videoBitRate,
+                    (path, width, height, videoBitRate, audio) => VideoKit.CreateHEVCRecorder(
+                        path,
                         width,
                         height,
                         frameRate,
-                        sampleRate,
-                        channelCount,
+                        audio ? sampleRate : 0,
+                        audio ? channelCount : 0,
                         videoBitRate,
                         keyframeInterval,
                         audioBitRate,
-                        out recorder
-                    ).Throw() == Status.Ok ? recorder : default);
+                        out var recorder
+                    ).Throw() == Status.Ok ? recorder : default
+                );
                 case Format.GIF: return new MediaRecorder(VideoKit.CreateGIFRecorder(
                         CreatePath(extension: @".gif", prefix: prefix),
                         width,
@@ -234,27 +452,39 @@ namespace VideoKit {
                         compressionQuality,
                         out recorder
                     ).Throw() == Status.Ok ? recorder : default);
-                case Format.AV1: return new MediaRecorder(VideoKit.CreateAV1Recorder(
-                        CreatePath(extension: @".mp4", prefix: prefix),
+                case Format.AV1: return new MediaRecorder(
+                    CreatePath(extension: @".mp4", prefix: prefix),
+                    width,
+                    height,
+                    videoBitRate,
+                    (path, width, height, videoBitRate, audio) => VideoKit.CreateAV1Recorder(
+                        path,
                         width,
                         height,
                         frameRate,
-                        sampleRate,
-                        channelCount,
+                        audio ? sampleRate : 0,
+                        audio ? channelCount : 0,
                         videoBitRate,
                         keyframeInterval,
                         audioBitRate,
-                        out recorder
-                    ).Throw() == Status.Ok ? recorder : default);
-                case Format.ProRes4444: return new MediaRecorder(VideoKit.CreateProRes4444Recorder(
-                        CreatePath(extension: @".mov", prefix: prefix),
+                        out var recorder
+                    ).Throw() == Status.Ok ? recorder : default
+                );
+                case Format.ProRes4444: return new MediaRecorder(
+                    CreatePath(extension: @".mov", prefix: prefix),
+                    width,
+                    height,
+                    videoBitRate,
+                    (path, width, height, videoBitRate, audio) => VideoKit.CreateProRes4444Recorder(
+                        path,
                         width,
                         height,
-                        sampleRate,
-                        channelCount,
+                        audio ? sampleRate : 0,
+                        audio ? channelCount : 0,
                         audioBitRate,
-                        out recorder
-                    ).Throw() == Status.Ok ? recorder : default);
+                        out var recorder
+                    ).Throw() == Status.Ok ? recorder : default
+                );
                 default: throw new InvalidOperationException($"Cannot create media recorder because format is not supported: {format}");
             }
         }
@@ -269,10 +499,62 @@ namespace VideoKit {
 
 
         #region --Operations--
-        private readonly IntPtr handle;
+        private Segment videoSegment;
+        private readonly Segment audioSegment;
+        private readonly string? path;
+        private readonly Func<string, int, int, int, bool, IntPtr>? factory;
+        private readonly List<(Task<MediaAsset> task, long timestamp)> segments = new();
+        private readonly List<Task> discards = new();
+        private readonly object fence = new();
+        private int videoBitRate;
+        private int segmentCount;
+        private long startTimestamp = -1L;
+        private readonly List<(long timestamp, long offset, int size)> metadata = new();
+        private FileStream? metadataStream;
+        private volatile Task<Segment>? nextSegment;
+        private volatile TaskCompletionSource<long>? splitCompletion;
+        private volatile PixelBuffer.Rotation displayRotation;
+        private volatile bool displayMirrored;
         private static string directory = string.Empty;
 
-        protected MediaRecorder (IntPtr handle) => this.handle = handle;
+        private IntPtr handle => videoSegment.handle;
+
+        /// <summary>
+        /// Native recorder writing one segment of the recording.
+        /// Appends only count themselves as pending, so that segments can be switched without blocking appends.
+        /// </summary>
+        private sealed class Segment {
+            public readonly IntPtr handle;
+            public readonly string? path;
+            public long timestamp = -1L;
+            public volatile bool empty = true;
+            public int pending;
+
+            public Segment(IntPtr handle, string? path = null) {
+                this.handle = handle;
+                this.path = path;
+            }
+
+            public void Drain() {
+                var spin = new SpinWait();
+                while (Volatile.Read(ref pending) > 0)
+                    spin.SpinOnce();
+            }
+        }
+
+        protected MediaRecorder (IntPtr handle) => videoSegment = audioSegment = new Segment(handle);
+
+        private MediaRecorder (
+            string path,
+            int width,
+            int height,
+            int videoBitRate,
+            Func<string, int, int, int, bool, IntPtr> factory
+        ) : this(factory(path, width, height, videoBitRate, true)) {
+            this.path = path;
+            this.factory = factory;
+            this.videoBitRate = videoBitRate;
+        }
 
         public static implicit operator IntPtr (MediaRecorder recorder) => recorder.handle;
 
@@ -280,7 +562,7 @@ namespace VideoKit {
 
         public static implicit operator Action<AudioBuffer> (MediaRecorder recorder) => recorder.Append;
 
-        protected static string CreatePath(string? extension = null, string? prefix = null) {
+        protected internal static string CreatePath(string? extension = null, string? prefix = null) {
             // Create parent directory
             var parentDirectory = !string.IsNullOrEmpty(prefix) ? Path.Combine(directory, prefix) : directory;
             Directory.CreateDirectory(parentDirectory);
@@ -291,6 +573,183 @@ namespace VideoKit {
             // Return
             return path;
         }
+
+        private static Segment Acquire(ref Segment field) {
+            for (;;) {
+                var segment = Volatile.Read(ref field);
+                Interlocked.Increment(ref segment.pending);
+                if (segment == Volatile.Read(ref field))
+                    return segment;
+                Interlocked.Decrement(ref segment.pending);
+            }
+        }
+
+        private Segment CreateSegment(int width, int height, int videoBitRate) {
+            // Create a video-only segment, so that audio keeps going to the first segment without priming at the join
+            var segmentPath = CreateSegmentPath(path!, Interlocked.Increment(ref segmentCount));
+            return new Segment(factory!(segmentPath, width, height, videoBitRate, false), segmentPath);
+        }
+
+        private void AppendSampleBuffer(AudioBuffer audioBuffer) {
+            // Audio is always appended to the first segment, so it never changes
+            var segment = audioSegment;
+            Interlocked.Increment(ref segment.pending);
+            try {
+                segment.empty = false;
+                segment.handle.AppendSampleBuffer(audioBuffer).Throw();
+            } finally {
+                Interlocked.Decrement(ref segment.pending);
+            }
+        }
+
+        private void SwitchSegment(Segment segment) {
+            var previous = Interlocked.Exchange(ref videoSegment, segment);
+            if (previous != audioSegment)
+                FinishSegment(previous);
+        }
+
+        private TaskCompletionSource<long>? StartSplit() {
+            lock (fence) {
+                var (split, next) = (splitCompletion, nextSegment);
+                if (split == null || (next != null && !next.IsCompleted))
+                    return null;
+                splitCompletion = null;
+                nextSegment = null;
+                if (next == null) // current segment has not started, or was started by `Reconfigure`
+                    return split;
+                if (next.IsFaulted) {
+                    split.TrySetException(next.Exception!.InnerExceptions);
+                    return null;
+                }
+                SwitchSegment(next.Result);
+                return split;
+            }
+        }
+
+        private void DiscardNextSegment() {
+            if (nextSegment != null)
+                discards.Add(DiscardSegment(nextSegment));
+            nextSegment = null;
+        }
+
+        private void FinishSegment(Segment segment) {
+            segment.Drain();
+            var timestamp = Interlocked.Read(ref segment.timestamp);
+            if (timestamp >= 0)
+                segments.Add((FinishWriting(segment.handle), timestamp));
+            else
+                discards.Add(DiscardSegment(segment.handle, segment.path!));
+        }
+
+        private static string CreateSegmentPath(string path, int index) => Path.Combine(
+            Path.GetDirectoryName(path),
+            $"{Path.GetFileNameWithoutExtension(path)}_{index}{Path.GetExtension(path)}"
+        );
+
+        private static Task<MediaAsset> FinishWriting(IntPtr recorder) {
+            var tcs = new TaskCompletionSource<MediaAsset>();
+            var handle = GCHandle.Alloc(tcs, GCHandleType.Normal);
+            try {
+                recorder.FinishWriting(OnFinishWriting, (IntPtr)handle).Throw();
+            } catch (Exception ex) {
+                handle.Free();
+                tcs.SetException(ex);
+            }
+            return tcs.Task;
+        }
+
+        private static async Task DiscardSegment(Task<Segment> task) {
+            Segment segment;
+            try {
+                segment = await task;
+            } catch (Exception) {
+                return;
+            }
+            await DiscardSegment(segment.handle, segment.path!);
+        }
+
+        private static async Task DiscardSegment(IntPtr recorder, string path) {
+            try {
+                await FinishWriting(recorder);
+            } catch (Exception) { } // recorders without frames may fail to finish
+            try {
+                File.Delete(path);
+            } catch (IOException) { }
+        }
+
+        private static async Task<MediaAsset> ConcatenateSegments(
+            (Task<MediaAsset> task, long timestamp)[] segments,
+            Task[] discards,
+            string path
+        ) {
+            // Wait for segments
+            await Task.WhenAll(discards);
+            var assets = await Task.WhenAll(segments.Select(segment => segment.task));
+            var paths = assets.Select(asset => asset.path!).ToArray();
+            // Stream-copy segments into a single file
+            await Task.Run(() => {
+                var movies = paths.Select(MP4Container.Read).ToArray();
+                var startTime = segments.Select(segment => segment.timestamp).FirstOrDefault(timestamp => timestamp >= 0);
+                var startTimes = segments.Select(segment => segment.timestamp >= 0 ? (segment.timestamp - startTime) / 1e+9 : 0.0).ToArray();
+                var movie = MP4Container.Concatenate(movies, startTimes);
+                var outputPath = CreateSegmentPath(path, 0);
+                MP4Container.Write(movie, outputPath);
+                foreach (var segmentPath in paths)
+                    File.Delete(segmentPath);
+                File.Move(outputPath, path);
+            });
+            // Return
+            return await MediaAsset.FromFile(path);
+        }
+
+        private static async Task<MediaAsset> AddMetadataTrack(
+            Task<MediaAsset> task,
+            string metadataPath,
+            (long timestamp, long offset, int size)[] buffers,
+            long startTimestamp
+        ) {
+            // Write track
+            var path = string.Empty;
+            try {
+                path = (await task).path!;
+                await Task.Run(() => {
+                    var id = MP4Container.Read(path).tracks.Select(track => track.id).DefaultIfEmpty(0u).Max() + 1;
+                    var track = MP4Container.CreateMetadataTrack(id, metadataPath, buffers, startTimestamp);
+                    MP4Container.AddTrack(path, track);
+                });
+            } finally {
+                try { File.Delete(metadataPath); }
+                catch (IOException) { }
+            }
+            // Return
+            return await MediaAsset.FromFile(path);
+        }
+
+        private static async Task<MediaAsset> WriteLoudness(
+            Task<MediaAsset> task,
+            float integratedLoudness,
+            float truePeak,
+            float samplePeak
+        ) {
+            // Write loudness
+            var asset = await task;
+            var path = asset.path!;
+            await Task.Run(() => MP4Container.SetLoudness(path, integratedLoudness, truePeak, samplePeak));
+            // Return
+            return await MediaAsset.FromFile(path);
+        }
+
+        internal static async Task<MediaAsset> ApplyDisplayTransform(
+            Task<MediaAsset> task,
+            PixelBuffer.Rotation rotation,
+            bool mirrored
+        ) {
+            // Write transform
+            var asset = await task;
+            await Task.Run(() => MP4Container.SetDisplayTransform(asset.path!, rotation, mirrored));
+            // Reload asset so that its metadata reflects the display transform
+            return await MediaAsset.FromFile(asset.path!);
+        }
         #endregion
 
 
@@ -0,0 +1,41 @@
+/*
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+#nullable enable
+
+namespace VideoKit {
+
+    using System;
+
+    /// <summary>
+    /// Metadata buffer.
+    /// The metadata buffer contains arbitrary timed data, like gameplay events, sensor readings, or detections,
+    /// which is written to a timed metadata track alongside video and audio.
+    /// </summary>
+    public readonly struct MetadataBuffer {
+
+        #region --Client API--
+        /// <summary>
+        /// Metadata.
+        /// </summary>
+        public readonly byte[] data;
+
+        /// <summary>
+        /// Timestamp in nanoseconds.
+        /// </summary>
+        public readonly long timestamp;
+
+        /// <summary>
+        /// Create a metadata buffer.
+        /// </summary>
+        /// <param name="data">Metadata.</param>
+        /// <param name="timestamp">Timestamp in nanoseconds.</param>
+        public MetadataBuffer(byte[] data, long timestamp = 0L) {
+            this.data = data ?? throw new ArgumentNullException(nameof(data));
+            this.timestamp = timestamp;
+        }
+        #endregion
+    }
+}
\ No newline at end of file
@@ -0,0 +1,201 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+#nullable enable
+
+namespace VideoKit {
+
+    using System;
+    using System.Collections.Concurrent;
+    using System.Collections.Generic;
+    using System.Threading;
+    using System.Threading.Tasks;
+    using Clocks;
+    using Internal;
+
+    /// <summary>
+    /// Motion-gated recorder which only records clips while there is motion in the video.
+    /// Each clip includes the frames shortly before motion started and shortly after it stopped.
+    /// NOTE: This only supports recording video.
+    /// NOTE: This is not supported on WebGL due to the lack of C# multithreading.
+    /// </summary>
+    public sealed class MotionGatedRecorder {
+
+        #region --Client API--
+        /// <summary>
+        /// Fraction of the frame in motion required to start recording a clip.
+        /// </summary>
+        public float startThreshold = 0.02f;
+
+        /// <summary>
+        /// Fraction of the frame in motion below which a clip stops recording after the post-roll duration.
+        /// This should be lower than the `startThreshold` to prevent clips from flickering on and off.
+        /// </summary>
+        public float stopThreshold = 0.005f;
+
+        /// <summary>
+        /// Event raised when a clip has been recorded.
+        /// NOTE: This event is raised on a worker thread.
+        /// </summary>
+        public event Action<MediaAsset>? OnClip;
+
+        /// <summary>
+        /// Create a motion-gated recorder.
+        /// </summary>
+        /// <param name="format">Recording format.</param>
+        /// <param name="width">Video width.</param>
+        /// <param name="height">Video height.</param>
+        /// <param name="frameRate">Video frame rate.</param>
+        /// <param name="preRoll">Duration in seconds to include before motion starts.</param>
+        /// <param name="postRoll">Duration in seconds to keep recording after motion stops.</param>
+        /// <param name="prefix">Subdirectory name to save recordings. This will be created if it does not exist.</param>
+        public MotionGatedRecorder(
+            MediaRecorder.Format format,
+            int width,
+            int height,
+            float frameRate,
+            float preRoll = 2f,
+            float postRoll = 2f,
+            string? prefix = null
+        ) {
+            this.format = format;
+            this.width = width;
+            this.height = height;
+            this.frameRate = frameRate;
+            this.preRollNs = (long)(preRoll * 1e+9);
+            this.postRollNs = (long)(postRoll * 1e+9);
+            this.prefix = prefix;
+            this.clock = new();
+            this.detector = new MotionDetector(width, height);
+            this.preRollQueue = new();
+            this.clips = new();
+            this.queue = new();
+            this.finishSource = new();
+            this.worker = new Thread(() => {
+                foreach (var action in queue.GetConsumingEnumerable())
+                    action();
+                finishSource.SetResult(true);
+            });
+            worker.Start();
+        }
+
+        /// <summary>
+        /// Append a pixel buffer.
+        /// </summary>
+        /// <param name="pixelBuffer">Pixel buffer.</param>
+        /// <param name="rotation">Rotation to apply to the pixel buffer.</param>
+        public void Append(
+            PixelBuffer pixelBuffer,
+            PixelBuffer.Rotation rotation = PixelBuffer.Rotation._0
+        ) {
+            // Check size
+            var portrait = rotation == PixelBuffer.Rotation._90 || rotation == PixelBuffer.Rotation._270;
+            var width = portrait ? pixelBuffer.height : pixelBuffer.width;
+            var height = portrait ? pixelBuffer.width : pixelBuffer.height;
+            if (width != this.width || height != this.height)
+                throw new ArgumentException($"Cannot append pixel buffer with size {width}x{height} to motion-gated recorder with size {this.width}x{this.height}");
+            // Copy pixel data to an `RGBA8888` buffer
+            var packet = new PixelBufferPacket(width, height, timestamp: clock.timestamp);
+            pixelBuffer.CopyTo(packet.buffer, rotation);
+            // Post work
+            queue.Add(() => FlushPacket(packet));
+        }
+
+        /// <summary>
+        /// Finish writing and return all recorded clips.
+        /// </summary>
+        public async Task<MediaAsset[]> FinishWriting() {
+            // Wait until writer thread is done
+            queue.CompleteAdding();
+            await finishSource.Task;
+            // Discard pre-roll
+            while (preRollQueue.Count > 0)
+                preRollQueue.Dequeue().Dispose();
+            // Finish the active clip
+            if (recorder != null)
+                clips.Add(FinishClip());
+            // Return
+            return await Task.WhenAll(clips);
+        }
+        #endregion
+
+
+        #region --Operations--
+        private readonly MediaRecorder.Format format;
+        private readonly int width;
+        private readonly int height;
+        private readonly float frameRate;
+        private readonly long preRollNs;
+        private readonly long postRollNs;
+        private readonly string? prefix;
+        private readonly RealtimeClock clock;
+        private readonly MotionDetector detector;
+        private readonly Queue<PixelBufferPacket> preRollQueue;
+        private readonly List<Task<MediaAsset>> clips;
+        private readonly BlockingCollection<Action> queue;
+        private readonly TaskCompletionSource<bool> finishSource;
+        private readonly Thread worker;
+        private MediaRecorder? recorder;
+        private long clipTimestamp;
+        private long lastMotionTimestamp;
+
+        private void FlushPacket(PixelBufferPacket packet) {
+            var timestamp = packet.buffer.timestamp;
+            var score = detector.Process(packet.data, width, height, width * 4);
+            // Buffer pre-roll while idle
+            if (recorder == null) {
+                preRollQueue.Enqueue(packet);
+                while (preRollQueue.Count > 1 && timestamp - preRollQueue.Peek().buffer.timestamp > preRollNs)
+                    preRollQueue.Dequeue().Dispose();
+                if (score < startThreshold)
+                    return;
+                // Start clip
+                recorder = MediaRecorder.Create(
+                    format: format,
+                    width: width,
+                    height: height,
+                    frameRate: frameRate,
+                    sampleRate: 0,
+                    channelCount: 0,
+                    prefix: prefix
+                ).Result;
+                clipTimestamp = preRollQueue.Peek().buffer.timestamp;
+                lastMotionTimestamp = timestamp;
+                while (preRollQueue.Count > 0)
+                    AppendPacket(preRollQueue.Dequeue());
+                return;
+            }
+            // Append frame
+            if (score >= stopThreshold)
+                lastMotionTimestamp = timestamp;
+            AppendPacket(packet);
+            // Stop clip once motion has settled
+            if (timestamp - lastMotionTimestamp > postRollNs)
+                clips.Add(FinishClip());
+        }
+
+        private unsafe void AppendPacket(PixelBufferPacket packet) {
+            fixed (byte* data = packet.data)
+                using (var pixelBuffer = new PixelBuffer(
+                    width: width,
+                    height: height,
+                    format: PixelBuffer.Format.RGBA8888,
+                    data: data,
+                    timestamp: packet.buffer.timestamp - clipTimestamp
+                ))
+                    recorder!.Append(pixelBuffer);
+            packet.Dispose();
+        }
+
+        private async Task<MediaAsset> FinishClip() {
+            var recorder = this.recorder!;
+            this.recorder = null;
+            var clip = await recorder.FinishWriting();
+            OnClip?.Invoke(clip);
+            return clip;
+        }
+        #endregion
+    }
+}
\ No newline at end of file
@@ -67,6 +67,20 @@ namespace VideoKit {
             /// </summary>
             _270 = 1
         }
+
+        /// <summary>
+        /// Tensor layout.
+        /// </summary>
+        public enum TensorLayout : int {
+            /// <summary>
+            /// Planar layout, with each color channel stored contiguously.
+            /// </summary>
+            NCHW = 0,
+            /// <summary>
+            /// Interleaved layout, with the color channels of each pixel stored contiguously.
+            /// </summary>
+            NHWC = 1,
+        }
         #endregion
 
 
@@ -350,6 +364,60 @@ namespace VideoKit {
             PixelBuffer destination,
             Rotation rotation = Rotation._0
         ) => handle.CopyToPixelBuffer(destination, rotation).Throw();
+
+        /// <summary>
+        /// Convert the pixel buffer into an RGB tensor for model inference.
+        /// The pixel buffer is resized, color converted, and normalized in a single pass, directly into the tensor.
+        /// Each tensor value is computed as `(value - mean) / std`, where `value` is in range [0, 1].
+        /// Letterboxed regions are filled with black.
+        /// </summary>
+        /// <param name="tensor">Destination tensor with `3 * width * height` elements.</param>
+        /// <param name="width">Tensor width.</param>
+        /// <param name="height">Tensor height.</param>
+        /// <param name="layout">Tensor layout.</param>
+        /// <param name="scaleMode">How the pixel buffer is fit into the tensor. `ScaleToFit` letterboxes while `ScaleAndCrop` center crops.</param>
+        /// <param name="mean">Per-channel RGB mean. Defaults to zero.</param>
+        /// <param name="std">Per-channel RGB standard deviation. Defaults to one.</param>
+        public void ToTensor(
+            Span<float> tensor,
+            int width,
+            int height,
+            TensorLayout layout = TensorLayout.NCHW,
+            ScaleMode scaleMode = ScaleMode.ScaleToFit,
+            float[]? mean = null,
+            float[]? std = null
+        ) => PixelBufferTensor.Convert(this, tensor, width, height, layout, scaleMode, mean, std);
+
+        /// <summary>
+        /// Convert the pixel buffer into a half precision RGB tensor for model inference.
+        /// The pixel buffer is resized, color converted, and normalized in a single pass, directly into the tensor.
+        /// Each tensor value is computed as `(value - mean) / std`, where `value` is in range [0, 1].
+        /// Letterboxed regions are filled with black.
+        /// </summary>
+        /// <param name="tensor">Destination tensor with `3 * width * height` IEEE half precision elements.</param>
+        /// <param name="width">Tensor width.</param>
+        /// <param name="height">Tensor height.</param>
+        /// <param name="layout">Tensor layout.</param>
+        /// <param name="scaleMode">How the pixel buffer is fit into the tensor. `ScaleToFit` letterboxes while `ScaleAndCrop` center crops.</param>
+        /// <param name="mean">Per-channel RGB mean. Defaults to zero.</param>
+        /// <param name="std">Per-channel RGB standard deviation. Defaults to one.</param>
+        public void ToTensor(
+            Span<ushort> tensor,
+            int width,
+            int height,
+            TensorLayout layout = TensorLayout.NCHW,
+            ScaleMode scaleMode = ScaleMode.ScaleToFit,
+            float[]? mean = null,
+            float[]? std = null
+        ) => PixelBufferTensor.Convert(this, tensor, width, height, layout, scaleMode, mean, std);
+
+        /// <summary>
+        /// Compute the luma statistics of the pixel buffer.
+        /// For large pixel buffers, sampling every few pixels is usually enough and is much faster.
+        /// </summary>
+        /// <param name="step">Sampling step in pixels along each axis.</param>
+        /// <returns>Luma statistics.</returns>
+        public PixelBufferStatistics ComputeStatistics(int step = 1) => PixelBufferStatistics.Compute(this, step);
         #endregion
 
 
@@ -0,0 +1,151 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+#nullable enable
+
+namespace VideoKit {
+
+    using System;
+    using System.Linq;
+    using Unity.Collections.LowLevel.Unsafe;
+
+    /// <summary>
+    /// Luma statistics of a pixel buffer.
+    /// This is typically used for auto-exposure UI, black frame detection, and thumbnail selection.
+    /// </summary>
+    public sealed class PixelBufferStatistics {
+
+        #region --Client API--
+        /// <summary>
+        /// Luma histogram with 256 bins.
+        /// </summary>
+        public readonly int[] histogram;
+
+        /// <summary>
+        /// Downsampled 8x8 luma signature, with rows stored top to bottom.
+        /// </summary>
+        public readonly byte[] signature;
+
+        /// <summary>
+        /// Number of pixels sampled.
+        /// </summary>
+        public readonly int pixelCount;
+
+        /// <summary>
+        /// Mean luma in range [0, 255].
+        /// </summary>
+        public readonly float mean;
+
+        /// <summary>
+        /// Luma variance.
+        /// </summary>
+        public readonly float variance;
+
+        /// <summary>
+        /// Minimum luma.
+        /// </summary>
+        public readonly byte min;
+
+        /// <summary>
+        /// Maximum luma.
+        /// </summary>
+        public readonly byte max;
+
+        /// <summary>
+        /// Luma standard deviation.
+        /// </summary>
+        public float standardDeviation => MathF.Sqrt(variance);
+
+        /// <summary>
+        /// Compute the mean absolute difference between the signatures of two pixel buffers.
+        /// </summary>
+        /// <param name="other">Other statistics.</param>
+        /// <returns>Signature difference in range [0, 1].</returns>
+        public float GetSignatureDistance(PixelBufferStatistics other) {
+            var sum = 0;
+            for (var i = 0; i < SignatureSize * SignatureSize; ++i)
+                sum += Math.Abs(signature[i] - other.signature[i]);
+            return sum / (255f * SignatureSize * SignatureSize);
+        }
+        #endregion
+
+
+        #region --Operations--
+        private const int SignatureSize = 8;
+
+        private PixelBufferStatistics(int[] histogram, byte[] signature) {
+            this.histogram = histogram;
+            this.signature = signature;
+            this.pixelCount = histogram.Sum();
+            if (pixelCount == 0)
+                return;
+            // Moments and extrema are derived from the histogram so that the pixel loop only bins
+            var (sum, sumSquares) = (0d, 0d);
+            for (var i = 0; i < histogram.Length; ++i) {
+                sum += (double)i * histogram[i];
+                sumSquares += (double)i * i * histogram[i];
+            }
+            this.mean = (float)(sum / pixelCount);
+            this.variance = (float)Math.Max(sumSquares / pixelCount - mean * (double)mean, 0d);
+            this.min = (byte)Array.FindIndex(histogram, count => count > 0);
+            this.max = (byte)Array.FindLastIndex(histogram, count => count > 0);
+        }
+
+        internal static unsafe PixelBufferStatistics Compute(PixelBuffer pixelBuffer, int step) {
+            // Check
+            if (step <= 0)
+                throw new ArgumentException($"Cannot compute pixel buffer statistics because sample step is invalid: {step}");
+            // Get luma layout
+            var format = pixelBuffer.format;
+            var (width, height) = (pixelBuffer.width, pixelBuffer.height);
+            byte* data;
+            int rowStride, pixelStride;
+            switch (format) {
+                case PixelBuffer.Format.RGBA8888:
+                case PixelBuffer.Format.BGRA8888:
+                    data = (byte*)pixelBuffer.data.GetUnsafeReadOnlyPtr();
+                    (rowStride, pixelStride) = (pixelBuffer.rowStride, 4);
+                    break;
+                case PixelBuffer.Format.YCbCr420:
+                    var plane = pixelBuffer.planes![0];
+                    data = (byte*)plane.data.GetUnsafeReadOnlyPtr();
+                    (rowStride, pixelStride) = (plane.rowStride, plane.pixelStride);
+                    break;
+                default:
+                    throw new ArgumentException($"Cannot compute pixel buffer statistics because format is not supported: {format}");
+            }
+            // Precompute signature cells
+            var cellX = new int[width];
+            for (var x = 0; x < width; ++x)
+                cellX[x] = x * SignatureSize / width;
+            var mirrored = pixelBuffer.verticallyMirrored;
+            var (redWeight, blueWeight) = format == PixelBuffer.Format.BGRA8888 ? (29, 77) : (77, 29);
+            // Bin
+            var histogram = new int[256];
+            var cellSums = new long[SignatureSize * SignatureSize];
+            var cellCounts = new int[SignatureSize * SignatureSize];
+            for (var y = 0; y < height; y += step) {
+                var row = data + y * rowStride;
+                var cellRow = (mirrored ? height - 1 - y : y) * SignatureSize / height * SignatureSize;
+                for (var x = 0; x < width; x += step) {
+                    var pixel = row + x * pixelStride;
+                    var luma = format == PixelBuffer.Format.YCbCr420 ?
+                        pixel[0] :
+                        (redWeight * pixel[0] + 150 * pixel[1] + blueWeight * pixel[2]) >> 8;
+                    ++histogram[luma];
+                    cellSums[cellRow + cellX[x]] += luma;
+                    ++cellCounts[cellRow + cellX[x]];
+                }
+            }
+            // Create signature
+            var signature = new byte[SignatureSize * SignatureSize];
+            for (var i = 0; i < signature.Length; ++i)
+                signature[i] = cellCounts[i] > 0 ? (byte)(cellSums[i] / cellCounts[i]) : (byte)0;
+            // Return
+            return new PixelBufferStatistics(histogram, signature);
+        }
+        #endregion
+    }
+}
\ No newline at end of file
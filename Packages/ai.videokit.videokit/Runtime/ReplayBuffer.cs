@@ -8,12 +8,11 @@
 namespace VideoKit {
 
     using System;
-    using System.Buffers;
     using System.Collections.Concurrent;
-    using System.Runtime.InteropServices;
     using System.Threading;
     using System.Threading.Tasks;
     using Clocks;
+    using Internal;
 
     /// <summary>
     /// Replay buffer for recording the last several seconds of video.
@@ -40,6 +39,7 @@ namespace VideoKit {
             float duration,
             string? prefix = null
         ) {
+            this.format = format;
             this.width = width;
             this.height = height;
             this.frameRate = frameRate;
@@ -60,6 +60,8 @@ namespace VideoKit {
 
         /// <summary>
         /// Append a pixel buffer.
+        /// For MP4 and MOV formats, pixel buffers are encoded as-is and the rotation is written to the container,
+        /// so the rotation of the last appended pixel buffer applies to the whole video.
         /// </summary>
         /// <param name="pixelBuffer">Pixel buffer.</param>
         /// <param name="rotation">Rotation to apply to the pixel buffer.</param>
@@ -74,8 +76,13 @@ namespace VideoKit {
             if (width != this.width || height != this.height)
                 throw new ArgumentException($"Cannot append pixel buffer with size {width}x{height} to replay buffer with size {this.width}x{this.height}");
             // Copy pixel data from the camera buffer to an `RGBA8888` buffer
-            var packet = new Packet(width, height, timestamp: clock.timestamp);
-            pixelBuffer.CopyTo(packet.buffer, rotation);
+            var transform = MP4Container.IsSupported(format);
+            var packet = transform ?
+                new PixelBufferPacket(pixelBuffer.width, pixelBuffer.height, timestamp: clock.timestamp) :
+                new PixelBufferPacket(width, height, timestamp: clock.timestamp);
+            pixelBuffer.CopyTo(packet.buffer, transform ? PixelBuffer.Rotation._0 : rotation);
+            if (transform)
+                this.rotation = rotation;
             // Post work
             queue.Add(() => FlushPacket(packet));
         }
@@ -107,6 +114,11 @@ namespace VideoKit {
                     format: format,
                     prefix: prefix
                 );
+            // Write display rotation
+            if (rotation != PixelBuffer.Rotation._0) {
+                await Task.Run(() => MP4Container.SetDisplayTransform(result.path!, rotation, false));
+                result = await MediaAsset.FromFile(result.path!);
+            }
             // Return
             return result;
         }
@@ -126,10 +138,11 @@ namespace VideoKit {
         private readonly TaskCompletionSource<bool> finishSource;
         private readonly Thread worker;
         private MediaRecorder? recorder;
+        private volatile PixelBuffer.Rotation rotation;
         private ulong recorderIdx;
         private Task<MediaAsset> chunkTask;
 
-        private void FlushPacket(in Packet packet) {
+        private void FlushPacket(in PixelBufferPacket packet) {
             // Create a new chunk if we hit duration
             var chunkIdx = (ulong)(packet.buffer.timestamp / chunkDurationNs);
             if (recorderIdx < chunkIdx && recorder != null) {
@@ -140,12 +153,11 @@ namespace VideoKit {
             if (recorder == null) {
                 recorder = MediaRecorder.Create( // CHECK
                     format: format,
-                    width: width,
-                    height: height,
+                    width: packet.buffer.width,
+                    height: packet.buffer.height,
                     frameRate: frameRate,
                     sampleRate: 0,
                     channelCount: 0,
-                    keyframeInterval: 1,
                     prefix: prefix
                 ).Result;
                 recorderIdx = chunkIdx;
@@ -155,45 +167,5 @@ namespace VideoKit {
             packet.Dispose();
         }
         #endregion
-
-
-        #region --Encoder Packets--
-        /// <summary>
-        /// This is basically a wrapper of a `PixelBuffer` along with bits required to save on allocations.
-        /// </summary>
-        private readonly struct Packet : IDisposable {
-
-            public readonly byte[] data; // allocated via `ArrayPool<T>`
-            public readonly GCHandle handle; // pins `data` so GC keeps it fixed
-            public readonly PixelBuffer buffer; // wraps `data`
-
-            /// <summary>
-            /// Create a packet which contains a `PixelBuffer` backed by data allocated from a memory pool.
-            /// </summary>
-            /// <param name="width">Pixel buffer width.</param>
-            /// <param name="height">Pixel buffer height.</param>
-            /// <param name="timestamp">Pixel buffer timestamp.</param>
-            public unsafe Packet(int width, int height, long timestamp) {
-                data = ArrayPool<byte>.Shared.Rent(width * height * 4);
-                handle = GCHandle.Alloc(data, GCHandleType.Pinned);
-                buffer = new PixelBuffer(
-                    width: width,
-                    height: height,
-                    format: PixelBuffer.Format.RGBA8888,
-                    data: (byte*)handle.AddrOfPinnedObject(),
-                    timestamp: timestamp
-                );
-            }
-
-            /// <summary>
-            /// Dispose the packet.
-            /// </summary>
-            public void Dispose() {
-                buffer.Dispose();
-                handle.Free();
-                ArrayPool<byte>.Shared.Return(data);
-            }
-        }
-        #endregion
     }
 }
\ No newline at end of file
@@ -0,0 +1,250 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+#nullable enable
+
+namespace VideoKit.Sources {
+
+    using System;
+    using System.Collections.Generic;
+    using System.Threading;
+    using Unity.Collections.LowLevel.Unsafe;
+
+    /// <summary>
+    /// Media source for mixing audio buffers from several inputs into a single stream.
+    /// Each input is resampled to the mixer format and aligned on a shared timeline using its timestamps.
+    /// Inputs never block: each input writes into its own lock-free ring buffer, and mixing happens on a worker thread.
+    /// NOTE: The handler is invoked on a worker thread.
+    /// NOTE: This is not supported on WebGL due to the lack of C# multithreading.
+    /// </summary>
+    public sealed class AudioMixerSource : IDisposable {
+
+        #region --Client API--
+        /// <summary>
+        /// Mixer sample rate.
+        /// </summary>
+        public readonly int sampleRate;
+
+        /// <summary>
+        /// Mixer channel count.
+        /// </summary>
+        public readonly int channelCount;
+
+        /// <summary>
+        /// Create an audio mixer source.
+        /// </summary>
+        /// <param name="sampleRate">Output sample rate.</param>
+        /// <param name="channelCount">Output channel count.</param>
+        /// <param name="handler">Handler to receive mixed audio buffers.</param>
+        /// <param name="frameSize">Number of sample frames in each mixed audio buffer.</param>
+        public AudioMixerSource(
+            int sampleRate,
+            int channelCount,
+            Action<AudioBuffer> handler,
+            int frameSize = 1024
+        ) {
+            if (sampleRate <= 0 || channelCount <= 0)
+                throw new ArgumentException($"Cannot create audio mixer source because format is invalid: {sampleRate}Hz {channelCount}ch");
+            this.sampleRate = sampleRate;
+            this.channelCount = channelCount;
+            this.handler = handler;
+            this.frameSize = Math.Max(frameSize, 1);
+            this.maxLatency = sampleRate / 5; // 200ms
+            this.inputs = new();
+            this.signal = new(false);
+            this.worker = new Thread(Mix);
+            worker.Start();
+        }
+
+        /// <summary>
+        /// Create an input to the mixer.
+        /// The returned delegate can be passed as the handler of any audio source.
+        /// </summary>
+        /// <param name="gain">Input gain.</param>
+        /// <returns>Handler which receives audio buffers for this input.</returns>
+        public Action<AudioBuffer> CreateInput(float gain = 1f) {
+            var input = new Input(this, gain);
+            lock (inputs)
+                inputs.Add(input);
+            return input.Append;
+        }
+
+        /// <summary>
+        /// Stop the mixer, mix all remaining audio, and release resources.
+        /// </summary>
+        public void Dispose() {
+            disposed = true;
+            signal.Set();
+            worker.Join();
+            signal.Dispose();
+        }
+        #endregion
+
+
+        #region --Operations--
+        private readonly Action<AudioBuffer> handler;
+        private readonly int frameSize;
+        private readonly int maxLatency;
+        private readonly List<Input> inputs;
+        private readonly AutoResetEvent signal;
+        private readonly Thread worker;
+        private long baseTimestamp = long.MinValue;
+        private long readPosition;
+        private volatile bool disposed;
+
+        private sealed class Input {
+
+            public readonly float[] ring; // interleaved output samples, indexed by absolute sample frame
+            public readonly int capacity; // in sample frames
+            public long writePosition => Volatile.Read(ref write);
+
+            public Input(AudioMixerSource mixer, float gain) {
+                this.mixer = mixer;
+                this.gain = gain;
+                this.capacity = 1 << (int)Math.Ceiling(Math.Log(mixer.sampleRate, 2)); // ~1s
+                this.ring = new float[capacity * mixer.channelCount];
+                this.write = -1L;
+            }
+
+            public unsafe void Append(AudioBuffer audioBuffer) {
+                // Check
+                var srcChannels = audioBuffer.channelCount;
+                var srcRate = audioBuffer.sampleRate;
+                var data = audioBuffer.data;
+                if (srcChannels <= 0 || srcRate <= 0 || data.Length == 0 || mixer.disposed)
+                    return;
+                // Compute timeline position
+                var timestamp = audioBuffer.timestamp;
+                Interlocked.CompareExchange(ref mixer.baseTimestamp, timestamp, long.MinValue);
+                var expected = (long)((timestamp - Interlocked.Read(ref mixer.baseTimestamp)) * 1e-9 * mixer.sampleRate);
+                var readPosition = Interlocked.Read(ref mixer.readPosition);
+                var position = write;
+                var resync = timestamp != 0L; // without timestamps, buffers are assumed to be contiguous
+                if (position < 0)
+                    position = Math.Max(expected, readPosition);
+                else if (resync && expected > position + mixer.maxLatency)
+                    position = Clear(position, Math.Min(expected, readPosition + capacity - 1));    // input dropped audio
+                else if (resync && expected < position - mixer.maxLatency)
+                    return;                                                                         // input is running ahead
+                // Resample
+                var dstChannels = mixer.channelCount;
+                var step = (double)srcRate / mixer.sampleRate;
+                var srcFrames = data.Length / srcChannels;
+                var src = (float*)data.GetUnsafeReadOnlyPtr();
+                previous ??= new float[srcChannels];
+                if (previous.Length != srcChannels) {
+                    previous = new float[srcChannels];
+                    phase = 0;
+                }
+                for (; phase < srcFrames - 1; phase += step, ++position) {
+                    // Drop audio when the mixer is behind
+                    if (position - readPosition >= capacity) {
+                        readPosition = Interlocked.Read(ref mixer.readPosition);
+                        if (position - readPosition >= capacity) {
+                            phase = srcFrames - 1;
+                            break;
+                        }
+                    }
+                    var index = (int)Math.Floor(phase);
+                    var t = (float)(phase - index);
+                    var offset = (int)(position & (capacity - 1)) * dstChannels;
+                    if (position < readPosition) // too late to be mixed
+                        continue;
+                    for (var c = 0; c < dstChannels; ++c) {
+                        float sample;
+                        if (dstChannels == 1 && srcChannels > 1) {
+                            var a = 0f;
+                            var b = 0f;
+                            for (var s = 0; s < srcChannels; ++s) {
+                                a += index < 0 ? previous[s] : src[index * srcChannels + s];
+                                b += src[(index + 1) * srcChannels + s];
+                            }
+                            sample = (a + t * (b - a)) / srcChannels;
+                        } else {
+                            var s = c % srcChannels;
+                            var a = index < 0 ? previous[s] : src[index * srcChannels + s];
+                            var b = src[(index + 1) * srcChannels + s];
+                            sample = a + t * (b - a);
+                        }
+                        ring[offset + c] = gain * sample;
+                    }
+                }
+                phase -= srcFrames;
+                for (var s = 0; s < srcChannels; ++s)
+                    previous[s] = src[(srcFrames - 1) * srcChannels + s];
+                // Publish
+                Volatile.Write(ref write, position);
+                mixer.signal.Set();
+            }
+
+            private readonly AudioMixerSource mixer;
+            private readonly float gain;
+            private float[]? previous;
+            private double phase;
+            private long write;
+
+            private long Clear(long from, long to) {
+                for (var position = from; position < to; ++position)
+                    Array.Clear(ring, (int)(position & (capacity - 1)) * mixer.channelCount, mixer.channelCount);
+                return Math.Max(from, to);
+            }
+        }
+
+        private unsafe void Mix() {
+            var frame = new float[frameSize * channelCount];
+            while (true) {
+                var finishing = disposed;
+                if (!finishing)
+                    signal.WaitOne(50);
+                // Check how far we can mix
+                Input[] inputs;
+                lock (this.inputs)
+                    inputs = this.inputs.ToArray();
+                var minWrite = long.MaxValue;
+                var maxWrite = long.MinValue;
+                foreach (var input in inputs) {
+                    var write = input.writePosition;
+                    if (write < 0)
+                        continue;
+                    minWrite = Math.Min(minWrite, write);
+                    maxWrite = Math.Max(maxWrite, write);
+                }
+                if (maxWrite == long.MinValue) {
+                    if (finishing)
+                        break;
+                    continue;
+                }
+                // Mix frames which every input has written, or which a lagging input has missed
+                while (true) {
+                    var end = readPosition + frameSize;
+                    var ready = minWrite >= end || maxWrite >= end + maxLatency;
+                    if (!ready && !(finishing && maxWrite > readPosition))
+                        break;
+                    var count = (int)Math.Min(frameSize, Math.Max(maxWrite - readPosition, 0));
+                    if (ready)
+                        count = frameSize;
+                    Array.Clear(frame, 0, frame.Length);
+                    foreach (var input in inputs) {
+                        var write = input.writePosition;
+                        for (var i = 0; i < count && readPosition + i < write; ++i) {
+                            var offset = (int)((readPosition + i) & (input.capacity - 1)) * channelCount;
+                            for (var c = 0; c < channelCount; ++c)
+                                frame[i * channelCount + c] += input.ring[offset + c];
+                        }
+                    }
+                    // Emit
+                    var timestamp = (baseTimestamp != long.MinValue ? baseTimestamp : 0L) + (long)(readPosition * 1e+9 / sampleRate);
+                    fixed (float* data = frame)
+                        using (var audioBuffer = new AudioBuffer(sampleRate, channelCount, data, count * channelCount, timestamp))
+                            handler(audioBuffer);
+                    Interlocked.Exchange(ref readPosition, readPosition + count);
+                }
+                if (finishing)
+                    break;
+            }
+        }
+        #endregion
+    }
+}
\ No newline at end of file
@@ -73,18 +73,23 @@ namespace VideoKit.Sources {
                 msaaSamples = Mathf.Max(QualitySettings.antiAliasing, 1)
             };
             this.textureSource = new TextureSource(width, height, handler);
-            VideoKitEvents.Instance.onFrame += OnFrame;
+            this.subscription = CaptureHub.Subscribe(
+                $"camera:{string.Join(",", Array.ConvertAll(cameras, camera => camera.GetInstanceID()))}",
+                width,
+                height,
+                false,
+                RenderCameras,
+                textureSource,
+                ShouldCapture,
+                clock
+            );
         }
 
         /// <summary>
         /// Stop the media source and release resources.
         /// </summary>
         public void Dispose() {
-            // Stop listening for events
-            var events = VideoKitEvents.OptionalInstance;
-            if (events != null)
-                events.onFrame -= OnFrame;
-            // Teardown
+            subscription.Dispose();
             textureSource.Dispose();
         }
         #endregion
@@ -93,12 +98,12 @@ namespace VideoKit.Sources {
         #region --Operations--
         private readonly IClock? clock;
         private readonly RenderTextureDescriptor descriptor;
+        private readonly IDisposable subscription;
         private int frameIdx;
 
-        private void OnFrame() {
-            // Check frame index
-            if (frameIdx++ % (frameSkip + 1) != 0)
-                return;
+        private bool ShouldCapture() => frameIdx++ % (frameSkip + 1) == 0;
+
+        private RenderTexture RenderCameras() {
             // Clear framebuffer
             var frameBuffer = RenderTexture.GetTemporary(descriptor);
             var prevActive = RenderTexture.active;
@@ -115,10 +120,8 @@ namespace VideoKit.Sources {
                 camera.Render();
                 camera.targetTexture = prevTarget;
             }
-            // Append
-            textureSource.Append(frameBuffer, clock?.timestamp ?? 0L);
-            // Release framebuffer
-            RenderTexture.ReleaseTemporary(frameBuffer);
+            // Return
+            return frameBuffer;
         }
         #endregion
 
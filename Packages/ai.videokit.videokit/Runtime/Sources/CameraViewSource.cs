@@ -8,7 +8,9 @@
 namespace VideoKit.Sources {
 
     using System;
+    using Unity.Collections.LowLevel.Unsafe;
     using Clocks;
+    using Internal;
     using UI;
 
     /// <summary>
@@ -23,6 +25,12 @@ namespace VideoKit.Sources {
         /// </summary>
         public int frameSkip;
 
+        /// <summary>
+        /// Overlay to blend into pixel buffers before they are sent to the handler.
+        /// The camera view pixel buffer is never modified; the overlay is blended into a copy.
+        /// </summary>
+        public PixelBufferOverlay? overlay;
+
         /// <summary>
         /// Create a camera device source.
         /// </summary>
@@ -55,10 +63,18 @@ namespace VideoKit.Sources {
         private readonly IClock? clock;
         private readonly VideoKitCameraView view;
         private int frameIdx;
+        private byte[]? overlayBuffer;
 
         private void OnPixelBuffer(PixelBuffer pixelBuffer) {
             if (frameIdx++ % (frameSkip + 1) != 0)
                 return;
+            // Check overlay
+            var overlay = this.overlay;
+            if (overlay != null && !overlay.isEmpty && pixelBuffer.format == PixelBuffer.Format.RGBA8888) {
+                OnOverlayPixelBuffer(pixelBuffer, overlay);
+                return;
+            }
+            // Invoke handler
             using var outputBuffer = new PixelBuffer(
                 width: pixelBuffer.width,
                 height: pixelBuffer.height,
@@ -70,6 +86,29 @@ namespace VideoKit.Sources {
             );
             handler(outputBuffer);
         }
+
+        private unsafe void OnOverlayPixelBuffer(PixelBuffer pixelBuffer, PixelBufferOverlay overlay) {
+            // Copy
+            var data = pixelBuffer.data;
+            var rowStride = pixelBuffer.rowStride;
+            overlayBuffer = overlayBuffer?.Length == data.Length ? overlayBuffer : new byte[data.Length];
+            fixed (byte* dst = overlayBuffer) {
+                Buffer.MemoryCopy(data.GetUnsafeReadOnlyPtr(), dst, data.Length, data.Length);
+                // Blend
+                overlay.Blend(dst, pixelBuffer.width, pixelBuffer.height, rowStride, pixelBuffer.verticallyMirrored);
+                // Invoke handler
+                using var outputBuffer = new PixelBuffer(
+                    width: pixelBuffer.width,
+                    height: pixelBuffer.height,
+                    format: pixelBuffer.format,
+                    data: dst,
+                    rowStride: rowStride,
+                    timestamp: clock?.timestamp ?? 0L,
+                    mirrored: pixelBuffer.verticallyMirrored
+                );
+                handler(outputBuffer);
+            }
+        }
         #endregion
     }
 }
\ No newline at end of file
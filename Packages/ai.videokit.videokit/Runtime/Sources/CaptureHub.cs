@@ -0,0 +1,166 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+#nullable enable
+
+namespace VideoKit.Sources {
+
+    using System;
+    using System.Collections.Generic;
+    using UnityEngine;
+    using Clocks;
+    using Internal;
+
+    /// <summary>
+    /// Capture hub which renders and reads back each frame once for all sources capturing the same content at the same resolution.
+    /// Sources which crop or watermark frames still share the render, but perform their own readback.
+    /// Each frame is rendered with the render delegate of the oldest live subscriber,
+    /// so the hub never keeps a disposed source alive.
+    /// </summary>
+    internal sealed class CaptureHub {
+
+        #region --Client API--
+        /// <summary>
+        /// Subscribe a texture source to receive frames from a shared capture.
+        /// NOTE: This must be called on the Unity main thread.
+        /// </summary>
+        /// <param name="key">Key identifying the captured content.</param>
+        /// <param name="width">Frame width.</param>
+        /// <param name="height">Frame height.</param>
+        /// <param name="useLateUpdate">Whether to capture in `LateUpdate` instead of at the end of the frame.</param>
+        /// <param name="render">Delegate which renders the content into a temporary render texture.</param>
+        /// <param name="textureSource">Texture source to receive frames.</param>
+        /// <param name="shouldCapture">Delegate which returns whether the subscriber wants the current frame.</param>
+        /// <param name="clock">Clock for generating pixel buffer timestamps.</param>
+        /// <returns>Subscription which must be disposed to stop receiving frames.</returns>
+        public static IDisposable Subscribe(
+            string key,
+            int width,
+            int height,
+            bool useLateUpdate,
+            Func<RenderTexture> render,
+            TextureSource textureSource,
+            Func<bool> shouldCapture,
+            IClock? clock
+        ) {
+            var hubKey = (key, width, height, useLateUpdate);
+            if (!Hubs.TryGetValue(hubKey, out var hub))
+                Hubs[hubKey] = hub = new CaptureHub(hubKey, width, height, useLateUpdate);
+            var subscriber = new Subscriber(hub, render, textureSource, shouldCapture, clock);
+            hub.subscribers.Add(subscriber);
+            return subscriber;
+        }
+        #endregion
+
+
+        #region --Operations--
+        private readonly (string, int, int, bool) key;
+        private readonly TextureSource readbackSource;
+        private readonly List<Subscriber> subscribers;
+        private readonly List<Subscriber> frameSubscribers = new();
+        private readonly List<(TextureSource, long)> targets = new();
+        private readonly Stack<List<(TextureSource, long)>> sharedTargetPool = new();
+        private static readonly Dictionary<(string, int, int, bool), CaptureHub> Hubs = new();
+
+        private sealed class Subscriber : IDisposable {
+            public readonly Func<RenderTexture> render;
+            public readonly TextureSource textureSource;
+            public readonly Func<bool> shouldCapture;
+            public readonly IClock? clock;
+            private readonly CaptureHub hub;
+
+            public Subscriber(
+                CaptureHub hub,
+                Func<RenderTexture> render,
+                TextureSource textureSource,
+                Func<bool> shouldCapture,
+                IClock? clock
+            ) {
+                this.hub = hub;
+                this.render = render;
+                this.textureSource = textureSource;
+                this.shouldCapture = shouldCapture;
+                this.clock = clock;
+            }
+
+            public void Dispose() => hub.Unsubscribe(this);
+        }
+
+        private CaptureHub(
+            (string, int, int, bool) key,
+            int width,
+            int height,
+            bool useLateUpdate
+        ) {
+            this.key = key;
+            this.readbackSource = new TextureSource(width, height, _ => { });
+            this.subscribers = new();
+            if (useLateUpdate)
+                VideoKitEvents.Instance.onLateUpdate += OnFrame;
+            else
+                VideoKitEvents.Instance.onFrame += OnFrame;
+        }
+
+        private void Unsubscribe(Subscriber subscriber) {
+            // Remove
+            subscribers.Remove(subscriber);
+            if (subscribers.Count > 0)
+                return;
+            // Stop listening for events
+            var events = VideoKitEvents.OptionalInstance;
+            if (events != null) {
+                events.onLateUpdate -= OnFrame;
+                events.onFrame -= OnFrame;
+            }
+            // Teardown
+            readbackSource.Dispose();
+            Hubs.Remove(key);
+        }
+
+        private void OnFrame() {
+            // Check which subscribers want this frame
+            var sharedTargets = sharedTargetPool.Count > 0 ? sharedTargetPool.Pop() : new List<(TextureSource, long)>();
+            frameSubscribers.AddRange(subscribers);
+            foreach (var subscriber in frameSubscribers)
+                if (subscriber.shouldCapture()) {
+                    var target = (subscriber.textureSource, subscriber.clock?.timestamp ?? 0L);
+                    if (subscriber.textureSource.isShareable)
+                        sharedTargets.Add(target);
+                    else
+                        targets.Add(target);
+                }
+            frameSubscribers.Clear();
+            if (subscribers.Count == 0 || (sharedTargets.Count == 0 && targets.Count == 0)) {
+                ReturnSharedTargets(sharedTargets);
+                targets.Clear();
+                return;
+            }
+            // Render
+            var frameBuffer = subscribers[0].render();
+            // Readback once for all shareable subscribers.
+            // The readback can complete on a later frame, so the target list is only returned to the pool once it does.
+            if (sharedTargets.Count > 0)
+                readbackSource.Append(frameBuffer, 0L, pixelBuffer => {
+                    foreach (var (textureSource, timestamp) in sharedTargets)
+                        textureSource.Append(pixelBuffer, timestamp);
+                    ReturnSharedTargets(sharedTargets);
+                });
+            else
+                ReturnSharedTargets(sharedTargets);
+            // Readback for subscribers which preprocess frames
+            foreach (var (textureSource, timestamp) in targets)
+                textureSource.Append(frameBuffer, timestamp);
+            // Release
+            RenderTexture.ReleaseTemporary(frameBuffer);
+            targets.Clear();
+        }
+
+        private void ReturnSharedTargets(List<(TextureSource, long)> sharedTargets) {
+            sharedTargets.Clear();
+            sharedTargetPool.Push(sharedTargets);
+        }
+        #endregion
+    }
+}
\ No newline at end of file
@@ -0,0 +1,121 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+#nullable enable
+
+namespace VideoKit.Sources {
+
+    using System;
+    using UnityEngine;
+    using UnityEngine.Rendering;
+    using Clocks;
+
+    /// <summary>
+    /// Media source for generating 360 degree equirectangular pixel buffers from a scene camera.
+    /// The camera is rendered into a cubemap which is projected to equirectangular on the GPU.
+    /// </summary>
+    public sealed class EquirectCameraSource : IDisposable {
+
+        #region --Client API--
+        /// <summary>
+        /// Camera being recorded from.
+        /// </summary>
+        public readonly Camera camera;
+
+        /// <summary>
+        /// Whether the source renders stereo top-bottom video, with the left eye in the top half.
+        /// </summary>
+        public readonly bool stereo;
+
+        /// <summary>
+        /// Texture source used to create pixel buffers from the equirectangular texture.
+        /// </summary>
+        public readonly TextureSource textureSource;
+
+        /// <summary>
+        /// Control number of successive camera frames to skip while recording.
+        /// </summary>
+        public int frameSkip;
+
+        /// <summary>
+        /// Create an equirectangular camera source.
+        /// Monoscopic video should have a 2:1 aspect ratio, and stereo top-bottom video should have a 1:1 aspect ratio.
+        /// </summary>
+        /// <param name="width">Pixel buffer width.</param>
+        /// <param name="height">Pixel buffer height.</param>
+        /// <param name="camera">Game camera to capture pixel buffers from.</param>
+        /// <param name="handler">Handler to receive pixel buffers.</param>
+        /// <param name="clock">Clock for generating pixel buffer timestamps.</param>
+        /// <param name="stereo">Whether to render stereo top-bottom video using the camera's stereo separation.</param>
+        public EquirectCameraSource(
+            int width,
+            int height,
+            Camera camera,
+            Action<PixelBuffer> handler,
+            IClock? clock = null,
+            bool stereo = false
+        ) {
+            // Compute cubemap face size, where each face covers a quarter of the horizontal field of view
+            var faceSize = Mathf.Min(Mathf.NextPowerOfTwo(Mathf.Max(width / 4, 16)), SystemInfo.maxTextureSize);
+            this.camera = camera;
+            this.stereo = stereo;
+            this.cubemapDescriptor = new(faceSize, faceSize, RenderTextureFormat.ARGBHalf, 24) {
+                sRGB = true,
+                dimension = TextureDimension.Cube
+            };
+            this.descriptor = new(width, height, RenderTextureFormat.ARGBHalf, 0) {
+                sRGB = true
+            };
+            this.textureSource = new TextureSource(width, height, handler);
+            this.subscription = CaptureHub.Subscribe(
+                $"equirect:{camera.GetInstanceID()}:{stereo}",
+                width,
+                height,
+                false,
+                RenderEquirect,
+                textureSource,
+                ShouldCapture,
+                clock
+            );
+        }
+
+        /// <summary>
+        /// Stop the media source and release resources.
+        /// </summary>
+        public void Dispose() {
+            subscription.Dispose();
+            textureSource.Dispose();
+        }
+        #endregion
+
+
+        #region --Operations--
+        private readonly RenderTextureDescriptor cubemapDescriptor;
+        private readonly RenderTextureDescriptor descriptor;
+        private readonly IDisposable subscription;
+        private int frameIdx;
+
+        private bool ShouldCapture() => frameIdx++ % (frameSkip + 1) == 0;
+
+        private RenderTexture RenderEquirect() {
+            var frameBuffer = RenderTexture.GetTemporary(descriptor);
+            if (!camera)
+                return frameBuffer;
+            var cubemap = RenderTexture.GetTemporary(cubemapDescriptor);
+            if (stereo) {
+                camera.RenderToCubemap(cubemap, 63, Camera.MonoOrStereoscopicEye.Left);
+                cubemap.ConvertToEquirect(frameBuffer, Camera.MonoOrStereoscopicEye.Left);
+                camera.RenderToCubemap(cubemap, 63, Camera.MonoOrStereoscopicEye.Right);
+                cubemap.ConvertToEquirect(frameBuffer, Camera.MonoOrStereoscopicEye.Right);
+            } else {
+                camera.RenderToCubemap(cubemap, 63, Camera.MonoOrStereoscopicEye.Mono);
+                cubemap.ConvertToEquirect(frameBuffer, Camera.MonoOrStereoscopicEye.Mono);
+            }
+            RenderTexture.ReleaseTemporary(cubemap);
+            return frameBuffer;
+        }
+        #endregion
+    }
+}
\ No newline at end of file
@@ -0,0 +1,192 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+#nullable enable
+
+namespace VideoKit.Sources {
+
+    using System;
+    using System.Collections.Concurrent;
+    using System.Collections.Generic;
+    using System.Threading;
+    using UnityEngine;
+    using UnityEngine.Rendering;
+    using Clocks;
+    using Internal;
+
+    /// <summary>
+    /// Media source for rendering scene cameras offline, faster or slower than real time, without dropping frames.
+    /// The source drives `Time.captureDeltaTime` so that every rendered frame advances game time by exactly one video frame.
+    /// When readbacks or the handler fall behind, the main thread is blocked until they catch up.
+    /// NOTE: The handler is invoked on a worker thread.
+    /// NOTE: This is not supported on WebGL due to the lack of C# multithreading.
+    /// </summary>
+    public sealed class OfflineCameraSource : IDisposable {
+
+        #region --Client API--
+        /// <summary>
+        /// Cameras being recorded from.
+        /// </summary>
+        public readonly Camera[] cameras;
+
+        /// <summary>
+        /// Clock used to generate pixel buffer timestamps.
+        /// </summary>
+        public readonly FixedClock clock;
+
+        /// <summary>
+        /// Create an offline camera source.
+        /// </summary>
+        /// <param name="width">Pixel buffer width.</param>
+        /// <param name="height">Pixel buffer height.</param>
+        /// <param name="frameRate">Video frame rate.</param>
+        /// <param name="cameras">Game cameras to capture pixel buffers from.</param>
+        /// <param name="handler">Handler to receive pixel buffers.</param>
+        /// <param name="maxPendingReadbacks">Maximum number of GPU readbacks in flight before the main thread waits.</param>
+        /// <param name="maxQueuedFrames">Maximum number of frames waiting for the handler before the main thread waits.</param>
+        public OfflineCameraSource(
+            int width,
+            int height,
+            float frameRate,
+            Camera[] cameras,
+            Action<PixelBuffer> handler,
+            int maxPendingReadbacks = 3,
+            int maxQueuedFrames = 4
+        ) {
+            Array.Sort(cameras, (a, b) => (int)(100 * (a.depth - b.depth)));
+            this.cameras = cameras;
+            this.clock = new FixedClock(frameRate);
+            this.maxPendingReadbacks = Math.Max(maxPendingReadbacks, 1);
+            this.frameDescriptor = new(width, height, RenderTextureFormat.ARGBHalf, 24) {
+                sRGB = true,
+                msaaSamples = Mathf.Max(QualitySettings.antiAliasing, 1)
+            };
+            this.readbackDescriptor = new(width, height, RenderTextureFormat.ARGB32, 0) {
+                sRGB = true
+            };
+            this.pendingReadbacks = new();
+            this.queue = new(Math.Max(maxQueuedFrames, 1));
+            this.worker = new Thread(() => {
+                foreach (var packet in queue.GetConsumingEnumerable()) {
+                    handler(packet.buffer);
+                    packet.Dispose();
+                }
+            });
+            this.captureDeltaTime = Time.captureDeltaTime;
+            Time.captureDeltaTime = 1f / frameRate;
+            worker.Start();
+            VideoKitEvents.Instance.onFrame += OnFrame;
+        }
+
+        /// <summary>
+        /// Stop the media source and release resources.
+        /// This blocks until every rendered frame has been sent to the handler.
+        /// </summary>
+        public void Dispose() {
+            // Stop listening for events
+            var events = VideoKitEvents.OptionalInstance;
+            if (events != null)
+                events.onFrame -= OnFrame;
+            // Flush
+            AsyncGPUReadback.WaitAllRequests();
+            pendingReadbacks.Clear();
+            queue.CompleteAdding();
+            worker.Join();
+            // Teardown
+            Time.captureDeltaTime = captureDeltaTime;
+            Texture2D.Destroy(readbackBuffer);
+        }
+        #endregion
+
+
+        #region --Operations--
+        private readonly int maxPendingReadbacks;
+        private readonly RenderTextureDescriptor frameDescriptor;
+        private readonly RenderTextureDescriptor readbackDescriptor;
+        private readonly Queue<AsyncGPUReadbackRequest> pendingReadbacks;
+        private readonly BlockingCollection<PixelBufferPacket> queue;
+        private readonly Thread worker;
+        private readonly float captureDeltaTime;
+        private Texture2D? readbackBuffer;
+
+        private void OnFrame() {
+            // Render cameras
+            var frameBuffer = RenderTexture.GetTemporary(frameDescriptor);
+            var prevActive = RenderTexture.active;
+            RenderTexture.active = frameBuffer;
+            GL.Clear(true, true, Color.clear);
+            RenderTexture.active = prevActive;
+            foreach (var camera in cameras) {
+                if (!camera)
+                    continue;
+                var prevTarget = camera.targetTexture;
+                camera.targetTexture = frameBuffer;
+                camera.Render();
+                camera.targetTexture = prevTarget;
+            }
+            // Convert
+            var renderTexture = RenderTexture.GetTemporary(readbackDescriptor);
+            Graphics.Blit(frameBuffer, renderTexture);
+            RenderTexture.ReleaseTemporary(frameBuffer);
+            // Readback
+            var timestamp = clock.timestamp;
+            if (SystemInfo.supportsAsyncGPUReadback)
+                pendingReadbacks.Enqueue(AsyncGPUReadback.Request(
+                    renderTexture,
+                    0,
+                    TextureFormat.RGBA32,
+                    request => OnReadback(request, timestamp)
+                ));
+            else
+                Readback(renderTexture, timestamp);
+            RenderTexture.ReleaseTemporary(renderTexture);
+            // Wait for readbacks to catch up
+            while (pendingReadbacks.Count > 0 && pendingReadbacks.Peek().done)
+                pendingReadbacks.Dequeue();
+            while (pendingReadbacks.Count > maxPendingReadbacks)
+                pendingReadbacks.Dequeue().WaitForCompletion();
+        }
+
+        private void OnReadback(AsyncGPUReadbackRequest request, long timestamp) {
+            // Check error
+            if (request.hasError) {
+                Debug.LogWarning("VideoKit OfflineCameraSource failed to readback texture data");
+                return;
+            }
+            // Enqueue
+            using var pixelBuffer = new PixelBuffer(
+                request.width,
+                request.height,
+                PixelBuffer.Format.RGBA8888,
+                request.GetData<byte>(),
+                timestamp: timestamp
+            );
+            Enqueue(pixelBuffer);
+        }
+
+        private void Readback(RenderTexture renderTexture, long timestamp) {
+            // Readback
+            readbackBuffer = readbackBuffer != null ?
+                readbackBuffer :
+                new Texture2D(renderTexture.width, renderTexture.height, TextureFormat.RGBA32, false);
+            var prevActive = RenderTexture.active;
+            RenderTexture.active = renderTexture;
+            readbackBuffer.ReadPixels(new Rect(0, 0, renderTexture.width, renderTexture.height), 0, 0, false);
+            RenderTexture.active = prevActive;
+            // Enqueue
+            using var pixelBuffer = new PixelBuffer(readbackBuffer, timestamp: timestamp);
+            Enqueue(pixelBuffer);
+        }
+
+        private void Enqueue(PixelBuffer pixelBuffer) {
+            if (queue.IsAddingCompleted)
+                return;
+            var packet = new PixelBufferPacket(pixelBuffer.width, pixelBuffer.height, pixelBuffer.timestamp);
+            pixelBuffer.CopyTo(packet.buffer);
+            queue.Add(packet); // blocks while the handler is behind
+        }
+        #endregion
+    }
+}
\ No newline at end of file
@@ -29,6 +29,16 @@ namespace VideoKit.Sources {
         /// </summary>
         public int frameSkip;
 
+        /// <summary>
+        /// Whether to skip frames which are identical to the previous frame.
+        /// This is useful for UI-heavy screen recordings which have long static periods.
+        /// See `TextureSource.skipDuplicateFrames` for more information.
+        /// </summary>
+        public bool skipDuplicateFrames {
+            get => textureSource.skipDuplicateFrames;
+            set => textureSource.skipDuplicateFrames = value;
+        }
+
         /// <summary>
         /// Create a screen source.
         /// </summary>
@@ -48,24 +58,24 @@ namespace VideoKit.Sources {
             this.clock = clock;
             this.descriptor = new(width, height, RenderTextureFormat.ARGBHalf, 0);
             this.textureSource = new(width, height, handler);
-            // Listen for frame events
-            if (useLateUpdate)
-                VideoKitEvents.Instance.onLateUpdate += OnFrame;
-            else
-                VideoKitEvents.Instance.onFrame += OnFrame;
+            // Subscribe to shared screen capture
+            this.subscription = CaptureHub.Subscribe(
+                @"screen",
+                width,
+                height,
+                useLateUpdate,
+                CaptureScreen,
+                textureSource,
+                ShouldCapture,
+                clock
+            );
         }
 
         /// <summary>
         /// Stop the screen source and release resources.
         /// </summary>
         public void Dispose() {
-            // Stop listening for events
-            var events = VideoKitEvents.OptionalInstance;
-            if (events != null) {
-                events.onLateUpdate -= OnFrame;
-                events.onFrame -= OnFrame;
-            }
-            // Teardown
+            subscription.Dispose();
             textureSource.Dispose();
         }
         #endregion
@@ -74,12 +84,12 @@ namespace VideoKit.Sources {
         #region --Operations--
         private readonly IClock? clock;
         private readonly RenderTextureDescriptor descriptor;
+        private readonly IDisposable subscription;
         private int frameIdx;
 
-        private void OnFrame() {
-            // Check frame index
-            if (frameIdx++ % (frameSkip + 1) != 0)
-                return;
+        private bool ShouldCapture() => frameIdx++ % (frameSkip + 1) == 0;
+
+        private RenderTexture CaptureScreen() {
             // Capture screen
             var screenBuffer = RenderTexture.GetTemporary(
                 Screen.width,
@@ -95,10 +105,9 @@ namespace VideoKit.Sources {
                 SystemInfo.graphicsUVStartsAtTop ? new Vector2(1, -1) : Vector2.one,
                 SystemInfo.graphicsUVStartsAtTop ? Vector2.up : Vector2.zero
             );
-            // Append
-            textureSource.Append(frameBuffer, clock?.timestamp ?? 0L);
-            RenderTexture.ReleaseTemporary(frameBuffer);
+            // Return
             RenderTexture.ReleaseTemporary(screenBuffer);
+            return frameBuffer;
         }
         #endregion
 
@@ -8,6 +8,8 @@
 namespace VideoKit.Sources {
 
     using System;
+    using Unity.Collections;
+    using Unity.Collections.LowLevel.Unsafe;
     using UnityEngine;
     using UnityEngine.Rendering;
     using Clocks;
@@ -54,6 +56,17 @@ namespace VideoKit.Sources {
         /// </summary>
         public int frameSkip;
 
+        /// <summary>
+        /// Whether to skip frames which are identical to the previous frame.
+        /// When enabled, a downsampled signature of each frame is read back and compared with that of the previous frame,
+        /// so static frames skip the full readback and encode. Frames are pipelined, so capture never waits on a readback.
+        /// Changes which are much smaller than a signature pixel, like a single changed pixel in a 4K frame, can go undetected.
+        /// A frame is still generated after many consecutive duplicates, and when the source is disposed,
+        /// so that static periods are not lost.
+        /// NOTE: Only enable this when recording to formats that respect pixel buffer timestamps (i.e. not GIF).
+        /// </summary>
+        public bool skipDuplicateFrames;
+
         /// <summary>
         /// Create a texture source.
         /// </summary>
@@ -85,52 +98,8 @@ namespace VideoKit.Sources {
             // Check handler
             if (handler == null)
                 return;
-            // Blit
-            var renderTexture = RenderTexture.GetTemporary(descriptor);
-            Preprocess(texture, renderTexture);
-            // Readback
-            if (SystemInfo.supportsAsyncGPUReadback)
-                AsyncGPUReadback.Request(renderTexture, 0, TextureFormat.RGBA32, request => {
-                    // Check handler
-                    if (handler == null)
-                        return;
-                    // Check error // Thanks Dr. Arth!
-                    if (request.hasError) {
-                        Debug.LogWarning("VideoKit TextureSource failed to readback texture data");
-                        return;
-                    }
-                    // Invoke handler
-                    using var pixelBuffer = new PixelBuffer(
-                        request.width,
-                        request.height,
-                        PixelBuffer.Format.RGBA8888,
-                        request.GetData<byte>(),
-                        timestamp: timestamp
-                    );
-                    handler(pixelBuffer);
-                });
-            else {
-                // Readback
-                readbackBuffer = readbackBuffer != null ?
-                    readbackBuffer :
-                    new Texture2D(descriptor.width, descriptor.height, TextureFormat.RGBA32, false);
-                var prevActive = RenderTexture.active;
-                RenderTexture.active = renderTexture;
-                readbackBuffer.ReadPixels(new Rect(0, 0, descriptor.width, descriptor.height), 0, 0, false);
-                // Invoke handler
-                using var pixelBuffer = new PixelBuffer(
-                    descriptor.width,
-                    descriptor.height,
-                    PixelBuffer.Format.RGBA8888,
-                    readbackBuffer.GetRawTextureData<byte>(),
-                    timestamp: timestamp
-                );
-                handler(pixelBuffer);
-                // Reassign
-                RenderTexture.active = prevActive;
-            }
-            // Release
-            RenderTexture.ReleaseTemporary(renderTexture);            
+            // Append
+            Append(texture, timestamp, handler);
         }
 
         /// <summary>
@@ -141,8 +110,11 @@ namespace VideoKit.Sources {
             var events = VideoKitEvents.OptionalInstance;
             if (events != null)
                 events.onFrame -= OnFrame;
+            // Emit the last skipped frame, so that static tails are not lost
+            EmitHeldFrame();
             // Teardown
             handler = null;
+            ReleaseHeldFrame();
             Texture2D.Destroy(readbackBuffer);
         }
         #endregion
@@ -154,12 +126,186 @@ namespace VideoKit.Sources {
         private readonly RenderTextureDescriptor descriptor;
         private int frameIdx;
         private Texture2D? readbackBuffer;
+        private ulong signature;
+        private int duplicateCount;
+        private RenderTexture? heldFrame;
+        private long heldTimestamp = -1L;
+        private const int SignatureWidth = 256;
+        private const int MaxDuplicateFrames = 60;
+
+        /// <summary>
+        /// Whether pixel buffers from this source can be shared with other sources capturing the same texture.
+        /// This is the case when the source does not crop, watermark, or skip frames.
+        /// </summary>
+        internal bool isShareable =>
+            watermark == null &&
+            !skipDuplicateFrames &&
+            regionOfInterest.x == 0 &&
+            regionOfInterest.y == 0 &&
+            regionOfInterest.width == descriptor.width &&
+            regionOfInterest.height == descriptor.height;
+
+        /// <summary>
+        /// Append a pixel buffer from a texture, sending the readback to a custom handler.
+        /// </summary>
+        internal void Append(Texture texture, long timestamp, Action<PixelBuffer> handler) {
+            // Blit
+            var renderTexture = RenderTexture.GetTemporary(descriptor);
+            Preprocess(texture, renderTexture);
+            // Readback
+            if (!SystemInfo.supportsAsyncGPUReadback)
+                Readback(renderTexture, timestamp, handler);
+            else if (skipDuplicateFrames) {
+                ReadbackSignatureAsync(renderTexture, timestamp, handler);
+                return;
+            }
+            else
+                ReadbackAsync(renderTexture, timestamp, handler);
+            // Release
+            RenderTexture.ReleaseTemporary(renderTexture);            
+        }
+
+        /// <summary>
+        /// Invoke the handler with a pixel buffer read back by another source.
+        /// </summary>
+        internal void Append(PixelBuffer pixelBuffer, long timestamp) {
+            // Check handler
+            if (handler == null)
+                return;
+            // Invoke handler
+            using var outputBuffer = new PixelBuffer(
+                pixelBuffer.width,
+                pixelBuffer.height,
+                pixelBuffer.format,
+                pixelBuffer.data,
+                timestamp: timestamp
+            );
+            handler(outputBuffer);
+        }
 
         private void OnFrame() {
             if (texture != null && frameIdx++ % (frameSkip + 1) == 0)
                 Append(texture, clock?.timestamp ?? 0L);
         }
 
+        private void ReadbackAsync(RenderTexture renderTexture, long timestamp, Action<PixelBuffer> handler) {
+            AsyncGPUReadback.Request(renderTexture, 0, TextureFormat.RGBA32, request => {
+                // Check handler
+                if (this.handler == null)
+                    return;
+                // Check error // Thanks Dr. Arth!
+                if (request.hasError) {
+                    Debug.LogWarning("VideoKit TextureSource failed to readback texture data");
+                    return;
+                }
+                // Invoke handler
+                using var pixelBuffer = new PixelBuffer(
+                    request.width,
+                    request.height,
+                    PixelBuffer.Format.RGBA8888,
+                    request.GetData<byte>(),
+                    timestamp: timestamp
+                );
+                handler(pixelBuffer);
+            });
+        }
+
+        private void ReadbackSignatureAsync(RenderTexture renderTexture, long timestamp, Action<PixelBuffer> handler) {
+            // Readback the signature, keeping the frame until it arrives.
+            // Readbacks complete in request order, so frames in flight are still emitted in order.
+            var signatureTexture = CreateSignatureTexture(renderTexture);
+            AsyncGPUReadback.Request(signatureTexture, 0, TextureFormat.RGBA32, request => {
+                // Check
+                if (this.handler == null || request.hasError) {
+                    RenderTexture.ReleaseTemporary(renderTexture);
+                    return;
+                }
+                // Hold duplicates, so that the last one can be emitted when the source is disposed
+                if (!IsNewFrame(request.GetData<byte>())) {
+                    ReleaseHeldFrame();
+                    (heldFrame, heldTimestamp) = (renderTexture, timestamp);
+                    return;
+                }
+                // Readback the frame
+                ReleaseHeldFrame();
+                ReadbackAsync(renderTexture, timestamp, handler);
+                RenderTexture.ReleaseTemporary(renderTexture);
+            });
+            RenderTexture.ReleaseTemporary(signatureTexture);
+        }
+
+        private void Readback(RenderTexture renderTexture, long timestamp, Action<PixelBuffer> handler) {
+            // Readback
+            readbackBuffer = readbackBuffer != null ?
+                readbackBuffer :
+                new Texture2D(descriptor.width, descriptor.height, TextureFormat.RGBA32, false);
+            var prevActive = RenderTexture.active;
+            RenderTexture.active = renderTexture;
+            readbackBuffer.ReadPixels(new Rect(0, 0, descriptor.width, descriptor.height), 0, 0, false);
+            RenderTexture.active = prevActive;
+            // Check duplicate
+            var data = readbackBuffer.GetRawTextureData<byte>();
+            heldTimestamp = -1L;
+            if (skipDuplicateFrames && !IsNewFrame(data)) {
+                heldTimestamp = timestamp; // the readback buffer keeps the frame until the next readback
+                return;
+            }
+            // Invoke handler
+            using var pixelBuffer = new PixelBuffer(
+                descriptor.width,
+                descriptor.height,
+                PixelBuffer.Format.RGBA8888,
+                data,
+                timestamp: timestamp
+            );
+            handler(pixelBuffer);
+        }
+
+        private void EmitHeldFrame() {
+            // Deliver frames still in flight, which come before the held frame.
+            // Signature callbacks can request frame readbacks, so wait twice.
+            if (heldFrame != null) {
+                AsyncGPUReadback.WaitAllRequests();
+                AsyncGPUReadback.WaitAllRequests();
+            }
+            // Check
+            if (heldTimestamp < 0 || handler == null)
+                return;
+            // Readback
+            var data = readbackBuffer?.GetRawTextureData<byte>() ?? default;
+            if (heldFrame != null) {
+                var request = AsyncGPUReadback.Request(heldFrame, 0, TextureFormat.RGBA32);
+                request.WaitForCompletion();
+                if (request.hasError)
+                    return;
+                data = request.GetData<byte>();
+            }
+            // Invoke handler
+            using var pixelBuffer = new PixelBuffer(
+                descriptor.width,
+                descriptor.height,
+                PixelBuffer.Format.RGBA8888,
+                data,
+                timestamp: heldTimestamp
+            );
+            handler(pixelBuffer);
+        }
+
+        private void ReleaseHeldFrame() {
+            if (heldFrame != null)
+                RenderTexture.ReleaseTemporary(heldFrame);
+            heldFrame = null;
+            heldTimestamp = -1L;
+        }
+
+        private bool IsNewFrame(NativeArray<byte> data) {
+            var signature = ComputeSignature(data);
+            var duplicate = signature == this.signature && duplicateCount < MaxDuplicateFrames;
+            this.signature = signature;
+            duplicateCount = duplicate ? duplicateCount + 1 : 0;
+            return !duplicate;
+        }
+
         private void Preprocess(Texture source, RenderTexture destination) {
             // Crop
             var cropDest = RenderTexture.GetTemporary(descriptor);
@@ -228,7 +374,7 @@ namespace VideoKit.Sources {
 
         #region --Utility--
 
-        private static Rect AspectFitRect(Texture watermark, RectInt frame) {
+        internal static Rect AspectFitRect(Texture watermark, RectInt frame) {
             var frameAspect = (float)frame.width / frame.height;
             var textureAspect = (float)watermark.width / watermark.height;
             var fitToWidth = textureAspect > frameAspect;
@@ -240,6 +386,40 @@ namespace VideoKit.Sources {
         }
 
         private static Rect ToRect(RectInt rect) => new(rect.x, rect.y, rect.width, rect.height);
+
+        private static RenderTexture CreateSignatureTexture(RenderTexture source) {
+            // Downsample by halving, rounding up so that edge pixels contribute to the signature
+            var result = source;
+            while (result.width > SignatureWidth) {
+                var halfTexture = RenderTexture.GetTemporary(
+                    (result.width + 1) / 2,
+                    (result.height + 1) / 2,
+                    0,
+                    RenderTextureFormat.ARGB32
+                );
+                Graphics.Blit(result, halfTexture);
+                if (result != source)
+                    RenderTexture.ReleaseTemporary(result);
+                result = halfTexture;
+            }
+            if (result == source) { // caller releases the source and signature separately
+                result = RenderTexture.GetTemporary(source.width, source.height, 0, RenderTextureFormat.ARGB32);
+                Graphics.Blit(source, result);
+            }
+            return result;
+        }
+
+        private static unsafe ulong ComputeSignature(NativeArray<byte> data) {
+            // FNV-1a over 64-bit words
+            var ptr = (byte*)data.GetUnsafeReadOnlyPtr();
+            var words = data.Length / sizeof(ulong);
+            var hash = 14695981039346656037UL;
+            for (var i = 0; i < words; ++i)
+                hash = (hash ^ ((ulong*)ptr)[i]) * 1099511628211UL;
+            for (var i = words * sizeof(ulong); i < data.Length; ++i)
+                hash = (hash ^ ptr[i]) * 1099511628211UL;
+            return hash;
+        }
         #endregion
     }
 }
\ No newline at end of file
@@ -0,0 +1,283 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+#nullable enable
+
+namespace VideoKit {
+
+    using System;
+    using System.Buffers.Binary;
+    using System.Collections.Generic;
+    using System.IO;
+    using System.Linq;
+    using System.Text;
+    using System.Threading.Tasks;
+    using Unity.Collections.LowLevel.Unsafe;
+    using UnityEngine;
+    using Internal;
+
+    /// <summary>
+    /// Audio sink which transcribes live audio incrementally while recording.
+    /// Audio is split into chunks at voice activity boundaries, and each chunk is transcribed in the background,
+    /// so that captions are ready shortly after speech ends instead of after the recording is finished.
+    /// Long utterances are split into overlapping chunks, and the overlapping words are merged.
+    /// NOTE: Transcription events are raised on a background thread.
+    /// </summary>
+    public sealed class StreamingTranscriber {
+
+        #region --Client API--
+        /// <summary>
+        /// Transcriber sample rate.
+        /// </summary>
+        public readonly int sampleRate;
+
+        /// <summary>
+        /// Transcriber channel count.
+        /// </summary>
+        public readonly int channelCount;
+
+        /// <summary>
+        /// Voice activity detector used to split audio into chunks.
+        /// </summary>
+        public readonly VoiceActivityDetector detector;
+
+        /// <summary>
+        /// Transcript of all chunks transcribed so far, in order.
+        /// </summary>
+        public string transcript {
+            get {
+                lock (fence)
+                    return text.ToString();
+            }
+        }
+
+        /// <summary>
+        /// Event raised with the text of each chunk as it is merged into the transcript.
+        /// Chunks are always merged and raised in the order they were spoken, one at a time.
+        /// </summary>
+        public event Action<string>? OnTranscription;
+
+        /// <summary>
+        /// Create a streaming transcriber.
+        /// </summary>
+        /// <param name="sampleRate">Audio sample rate.</param>
+        /// <param name="channelCount">Audio channel count.</param>
+        /// <param name="transcriber">Delegate which transcribes a WAV file stream. When `null`, the VideoKit transcription predictor is used, so pointing the `VideoKitClient` at a local endpoint is enough for testing.</param>
+        /// <param name="maxChunkDuration">Maximum chunk duration in seconds before a long utterance is split.</param>
+        /// <param name="overlap">Duration in seconds of audio shared between consecutive chunks of a split utterance.</param>
+        public StreamingTranscriber(
+            int sampleRate,
+            int channelCount,
+            Func<Stream, Task<string>>? transcriber = null,
+            float maxChunkDuration = 10f,
+            float overlap = 1f
+        ) {
+            // Check
+            if (sampleRate <= 0 || channelCount <= 0)
+                throw new ArgumentException($"Cannot create streaming transcriber because format is invalid: {sampleRate}Hz {channelCount}ch");
+            if (overlap >= maxChunkDuration)
+                throw new ArgumentException($"Cannot create streaming transcriber because overlap is not shorter than chunk duration: {overlap}");
+            // Create
+            this.sampleRate = sampleRate;
+            this.channelCount = channelCount;
+            this.detector = new VoiceActivityDetector(sampleRate, channelCount);
+            this.transcriber = transcriber ?? Transcribe;
+            this.maxChunkSamples = (int)(maxChunkDuration * sampleRate) * channelCount;
+            this.overlapSamples = (int)(Math.Max(overlap, 0f) * sampleRate) * channelCount;
+            this.preRollSamples = Math.Min((int)(PreRoll * sampleRate), maxChunkSamples / channelCount / 2) * channelCount;
+            this.chunk = new float[maxChunkSamples];
+        }
+
+        /// <summary>
+        /// Append an audio buffer to be transcribed.
+        /// </summary>
+        /// <param name="audioBuffer">Audio buffer. This MUST have the same format as the transcriber.</param>
+        public unsafe void Append(AudioBuffer audioBuffer) {
+            // Check
+            if (audioBuffer.sampleRate != sampleRate || audioBuffer.channelCount != channelCount)
+                throw new ArgumentException($"Cannot transcribe audio buffer because format does not match transcriber: {audioBuffer.sampleRate}Hz {audioBuffer.channelCount}ch");
+            // Append
+            var data = audioBuffer.data;
+            Append(new ReadOnlySpan<float>(data.GetUnsafeReadOnlyPtr(), data.Length));
+        }
+
+        /// <summary>
+        /// Append interleaved linear PCM audio to be transcribed.
+        /// </summary>
+        /// <param name="samples">Interleaved audio samples with the same format as the transcriber.</param>
+        public void Append(ReadOnlySpan<float> samples) {
+            lock (fence) {
+                var speech = detector.Process(samples);
+                // Keep a short pre-roll of silence so that speech onsets are not cut
+                if (!speech && !chunkHasSpeech) {
+                    Write(samples.Length > preRollSamples ? samples.Slice(samples.Length - preRollSamples) : samples);
+                    if (chunkLength > preRollSamples) {
+                        Array.Copy(chunk, chunkLength - preRollSamples, chunk, 0, preRollSamples);
+                        chunkLength = preRollSamples;
+                    }
+                    return;
+                }
+                // Append speech, splitting long utterances
+                chunkHasSpeech = true;
+                while (samples.Length > 0) {
+                    var count = Math.Min(samples.Length, maxChunkSamples - chunkLength);
+                    Write(samples.Slice(0, count));
+                    samples = samples.Slice(count);
+                    if (chunkLength == maxChunkSamples)
+                        Submit(true);
+                }
+                // Submit utterance once speech ends
+                if (!speech)
+                    Submit(false);
+            }
+        }
+
+        /// <summary>
+        /// Transcribe any remaining audio and wait for all pending transcriptions.
+        /// </summary>
+        /// <returns>Full transcript.</returns>
+        public async Task<string> FinishTranscribing() {
+            Task[] tasks;
+            lock (fence) {
+                if (chunkHasSpeech)
+                    Submit(false);
+                tasks = pending.ToArray();
+            }
+            await Task.WhenAll(tasks);
+            return transcript;
+        }
+
+        public static implicit operator Action<AudioBuffer> (StreamingTranscriber transcriber) => transcriber.Append;
+        #endregion
+
+
+        #region --Operations--
+        private readonly object fence = new();
+        private readonly object notifyFence = new();
+        private readonly Func<Stream, Task<string>> transcriber;
+        private readonly int maxChunkSamples;
+        private readonly int overlapSamples;
+        private readonly int preRollSamples;
+        private readonly float[] chunk;
+        private readonly List<Task> pending = new();
+        private readonly Dictionary<int, (string text, bool overlapped)> results = new();
+        private readonly StringBuilder text = new();
+        private readonly List<string> tail = new();
+        private readonly Queue<string> merged = new();
+        private int chunkLength;
+        private bool chunkHasSpeech;
+        private bool chunkOverlapped;
+        private int submittedCount;
+        private int mergedCount;
+        private const float PreRoll = 0.3f;
+        private const int MaxOverlapWords = 8;
+
+        private void Write(ReadOnlySpan<float> samples) {
+            samples.CopyTo(chunk.AsSpan(chunkLength));
+            chunkLength += samples.Length;
+        }
+
+        private void Submit(bool split) {
+            // Encode
+            var wav = CreateWAV(chunk.AsSpan(0, chunkLength), sampleRate, channelCount);
+            var index = submittedCount++;
+            var overlapped = chunkOverlapped;
+            pending.RemoveAll(task => task.IsCompleted);
+            pending.Add(Task.Run(() => TranscribeChunk(index, overlapped, wav)));
+            // Start next chunk
+            var carry = split ? Math.Min(overlapSamples, chunkLength) : 0;
+            Array.Copy(chunk, chunkLength - carry, chunk, 0, carry);
+            chunkLength = carry;
+            chunkHasSpeech = split;
+            chunkOverlapped = split && carry > 0;
+        }
+
+        private async Task TranscribeChunk(int index, bool overlapped, byte[] wav) {
+            // Transcribe
+            var result = string.Empty;
+            try {
+                using var stream = new MemoryStream(wav, false);
+                result = await transcriber(stream) ?? string.Empty;
+            } catch (Exception ex) {
+                Debug.LogWarning($"VideoKit: Streaming transcriber failed to transcribe chunk with error: {ex.Message}");
+            }
+            // Merge in order
+            lock (fence) {
+                results[index] = (result, overlapped);
+                while (results.Remove(mergedCount, out var next)) {
+                    var chunkText = Merge(next.text, next.overlapped);
+                    if (chunkText.Length > 0)
+                        merged.Enqueue(chunkText);
+                    ++mergedCount;
+                }
+            }
+            // Notify in merge order, even when chunks finish merging on different threads
+            lock (notifyFence)
+                for (;;) {
+                    string chunkText;
+                    lock (fence) {
+                        if (merged.Count == 0)
+                            break;
+                        chunkText = merged.Dequeue();
+                    }
+                    OnTranscription?.Invoke(chunkText);
+                }
+        }
+
+        private string Merge(string chunkText, bool overlapped) {
+            var words = chunkText.Split((char[]?)null, StringSplitOptions.RemoveEmptyEntries).ToList();
+            // Drop words repeated from the overlapping audio
+            if (overlapped)
+                for (var count = Math.Min(Math.Min(tail.Count, words.Count), MaxOverlapWords); count > 0; --count)
+                    if (Enumerable.Range(0, count).All(i => Normalize(tail[tail.Count - count + i]) == Normalize(words[i]))) {
+                        words.RemoveRange(0, count);
+                        break;
+                    }
+            // Append
+            var result = string.Join(@" ", words);
+            if (result.Length == 0)
+                return result;
+            if (text.Length > 0)
+                text.Append(' ');
+            text.Append(result);
+            tail.AddRange(words);
+            if (tail.Count > MaxOverlapWords)
+                tail.RemoveRange(0, tail.Count - MaxOverlapWords);
+            return result;
+        }
+
+        private static string Normalize(string word) => new string(word.Where(char.IsLetterOrDigit).ToArray()).ToLowerInvariant();
+
+        private static byte[] CreateWAV(ReadOnlySpan<float> samples, int sampleRate, int channelCount) {
+            var result = new byte[44 + 2 * samples.Length];
+            var header = result.AsSpan();
+            Encoding.ASCII.GetBytes(@"RIFF").CopyTo(header);
+            BinaryPrimitives.WriteInt32LittleEndian(header.Slice(4), result.Length - 8);
+            Encoding.ASCII.GetBytes(@"WAVEfmt ").CopyTo(header.Slice(8));
+            BinaryPrimitives.WriteInt32LittleEndian(header.Slice(16), 16);
+            BinaryPrimitives.WriteInt16LittleEndian(header.Slice(20), 1); // PCM
+            BinaryPrimitives.WriteInt16LittleEndian(header.Slice(22), (short)channelCount);
+            BinaryPrimitives.WriteInt32LittleEndian(header.Slice(24), sampleRate);
+            BinaryPrimitives.WriteInt32LittleEndian(header.Slice(28), sampleRate * channelCount * 2);
+            BinaryPrimitives.WriteInt16LittleEndian(header.Slice(32), (short)(channelCount * 2));
+            BinaryPrimitives.WriteInt16LittleEndian(header.Slice(34), 16);
+            Encoding.ASCII.GetBytes(@"data").CopyTo(header.Slice(36));
+            BinaryPrimitives.WriteInt32LittleEndian(header.Slice(40), 2 * samples.Length);
+            for (var i = 0; i < samples.Length; ++i)
+                BinaryPrimitives.WriteInt16LittleEndian(header.Slice(44 + 2 * i), (short)(Math.Clamp(samples[i], -1f, 1f) * short.MaxValue));
+            return result;
+        }
+
+        private static async Task<string> Transcribe(Stream stream) {
+            var openai = VideoKitClient.Instance!.muna.Beta.OpenAI;
+            var transcription = await openai.Audio.Transcriptions.Create(
+                model: MediaAsset.TranscribeTag,
+                file: stream
+            );
+            return transcription.Text;
+        }
+        #endregion
+    }
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+#nullable enable
+
+namespace VideoKit {
+
+    using UnityEngine;
+
+    /// <summary>
+    /// Scene in a video, bounded by cuts.
+    /// </summary>
+    public sealed class VideoScene {
+
+        #region --Client API--
+        /// <summary>
+        /// Scene start time in seconds.
+        /// </summary>
+        public readonly float startTime;
+
+        /// <summary>
+        /// Scene end time in seconds.
+        /// </summary>
+        public readonly float endTime;
+
+        /// <summary>
+        /// Time in seconds of the frame selected as the scene thumbnail.
+        /// </summary>
+        public readonly float thumbnailTime;
+
+        /// <summary>
+        /// Thumbnail width.
+        /// </summary>
+        public readonly int thumbnailWidth;
+
+        /// <summary>
+        /// Thumbnail height.
+        /// </summary>
+        public readonly int thumbnailHeight;
+
+        /// <summary>
+        /// Thumbnail pixel data in `RGBA8888` format.
+        /// </summary>
+        public readonly byte[] thumbnail;
+
+        /// <summary>
+        /// Scene duration in seconds.
+        /// </summary>
+        public float duration => endTime - startTime;
+
+        /// <summary>
+        /// Create a texture from the scene thumbnail.
+        /// NOTE: This MUST be called on the Unity main thread.
+        /// </summary>
+        /// <returns>Thumbnail texture.</returns>
+        public Texture2D ToTexture() {
+            var texture = new Texture2D(thumbnailWidth, thumbnailHeight, TextureFormat.RGBA32, false);
+            texture.LoadRawTextureData(thumbnail);
+            texture.Apply();
+            return texture;
+        }
+        #endregion
+
+
+        #region --Operations--
+
+        internal VideoScene(
+            float startTime,
+            float endTime,
+            float thumbnailTime,
+            int thumbnailWidth,
+            int thumbnailHeight,
+            byte[] thumbnail
+        ) {
+            this.startTime = startTime;
+            this.endTime = endTime;
+            this.thumbnailTime = thumbnailTime;
+            this.thumbnailWidth = thumbnailWidth;
+            this.thumbnailHeight = thumbnailHeight;
+            this.thumbnail = thumbnail;
+        }
+        #endregion
+    }
+}
\ No newline at end of file
@@ -0,0 +1,234 @@
+/* 
+*   VideoKit
+*   Copyright © 2026 Yusuf Olokoba. All Rights Reserved.
+*/
+
+#nullable enable
+
+namespace VideoKit {
+
+    using System;
+    using System.Buffers;
+    using System.Collections.Generic;
+    using System.Numerics;
+    using Unity.Collections;
+    using Unity.Collections.LowLevel.Unsafe;
+
+    /// <summary>
+    /// Voice activity detector which classifies audio as speech or silence.
+    /// Audio is analyzed in 10ms frames using its energy relative to an adaptive noise floor, and its zero-crossing rate.
+    /// </summary>
+    public sealed class VoiceActivityDetector {
+
+        #region --Client API--
+        /// <summary>
+        /// Detector sample rate.
+        /// </summary>
+        public readonly int sampleRate;
+
+        /// <summary>
+        /// Detector channel count.
+        /// </summary>
+        public readonly int channelCount;
+
+        /// <summary>
+        /// Level in dB above the noise floor at which audio is considered speech.
+        /// </summary>
+        public float threshold = 9f;
+
+        /// <summary>
+        /// Minimum level in dBFS for audio to be considered speech.
+        /// </summary>
+        public float minimumLevel = -55f;
+
+        /// <summary>
+        /// Duration in seconds that the detector keeps reporting speech after speech stops.
+        /// This prevents short pauses and trailing consonants from being cut.
+        /// </summary>
+        public float hangover = 0.3f;
+
+        /// <summary>
+        /// Whether speech was detected in the most recently processed audio.
+        /// </summary>
+        public bool speech => hangoverFrames > 0;
+
+        /// <summary>
+        /// Estimated noise floor in dBFS.
+        /// </summary>
+        public float noiseFloor => float.IsNaN(noiseLevel) ? float.NegativeInfinity : noiseLevel;
+
+        /// <summary>
+        /// Create a voice activity detector.
+        /// </summary>
+        /// <param name="sampleRate">Audio sample rate.</param>
+        /// <param name="channelCount">Audio channel count.</param>
+        public VoiceActivityDetector(int sampleRate, int channelCount) {
+            // Check
+            if (sampleRate <= 0 || channelCount <= 0)
+                throw new ArgumentException($"Cannot create voice activity detector because format is invalid: {sampleRate}Hz {channelCount}ch");
+            // Create
+            this.sampleRate = sampleRate;
+            this.channelCount = channelCount;
+            this.frameSize = Math.Max(sampleRate / 100, 16);
+            this.frame = new float[frameSize];
+        }
+
+        /// <summary>
+        /// Process an audio buffer.
+        /// </summary>
+        /// <param name="audioBuffer">Audio buffer. This MUST have the same format as the detector.</param>
+        /// <returns>Whether the audio buffer contains speech.</returns>
+        public unsafe bool Process(AudioBuffer audioBuffer) {
+            // Check
+            if (audioBuffer.sampleRate != sampleRate || audioBuffer.channelCount != channelCount)
+                throw new ArgumentException($"Cannot process audio buffer because format does not match detector: {audioBuffer.sampleRate}Hz {audioBuffer.channelCount}ch");
+            // Process
+            var data = audioBuffer.data;
+            return Process(new ReadOnlySpan<float>(data.GetUnsafeReadOnlyPtr(), data.Length));
+        }
+
+        /// <summary>
+        /// Process interleaved linear PCM audio.
+        /// </summary>
+        /// <param name="data">Interleaved audio samples with the same format as the detector.</param>
+        /// <returns>Whether the audio contains speech.</returns>
+        public bool Process(ReadOnlySpan<float> data) {
+            var result = hangoverFrames > 0;
+            for (var i = 0; i + channelCount <= data.Length; i += channelCount) {
+                // Downmix
+                var sample = 0f;
+                for (var c = 0; c < channelCount; ++c)
+                    sample += data[i + c];
+                frame[framePosition++] = sample / channelCount;
+                if (framePosition < frameSize)
+                    continue;
+                // Classify
+                framePosition = 0;
+                if (ProcessFrame())
+                    hangoverFrames = Math.Max((int)(hangover * 100f), 1);
+                else if (hangoverFrames > 0)
+                    --hangoverFrames;
+                result |= hangoverFrames > 0;
+            }
+            return result;
+        }
+
+        /// <summary>
+        /// Create a gate which only forwards audio buffers that contain speech.
+        /// Silent audio buffers are dropped, and timestamps are shifted so that the forwarded audio is contiguous.
+        /// The returned delegate can be passed as the handler of any audio source.
+        /// </summary>
+        /// <param name="handler">Handler to receive audio buffers containing speech.</param>
+        /// <param name="preRoll">Duration in seconds of silent audio to forward before speech starts.</param>
+        /// <returns>Handler which receives audio buffers to gate.</returns>
+        public Action<AudioBuffer> CreateGate(Action<AudioBuffer> handler, float preRoll = 0.2f) {
+            var gate = new Gate(this, handler, preRoll);
+            return gate.Append;
+        }
+
+        /// <summary>
+        /// Reset the detector.
+        /// </summary>
+        public void Reset() {
+            framePosition = 0;
+            hangoverFrames = 0;
+            noiseLevel = float.NaN;
+        }
+        #endregion
+
+
+        #region --Operations--
+        private readonly int frameSize;
+        private readonly float[] frame;
+        private int framePosition;
+        private int hangoverFrames;
+        private float noiseLevel = float.NaN;
+
+        private sealed class Gate {
+
+            public Gate(VoiceActivityDetector detector, Action<AudioBuffer> handler, float preRoll) {
+                this.detector = detector;
+                this.handler = handler;
+                this.maxPreRollSamples = (int)(Math.Max(preRoll, 0f) * detector.sampleRate) * detector.channelCount;
+                this.preRoll = new();
+            }
+
+            public unsafe void Append(AudioBuffer audioBuffer) {
+                var data = audioBuffer.data;
+                var sampleRate = audioBuffer.sampleRate;
+                var channelCount = audioBuffer.channelCount;
+                var timestamp = audioBuffer.timestamp;
+                // Buffer silence
+                if (!detector.Process(audioBuffer)) {
+                    var samples = ArrayPool<float>.Shared.Rent(data.Length);
+                    NativeArray<float>.Copy(data, samples, data.Length);
+                    preRoll.Enqueue((samples, data.Length, timestamp));
+                    preRollSamples += data.Length;
+                    while (preRoll.Count > 0 && preRollSamples - preRoll.Peek().count >= maxPreRollSamples) {
+                        var (dropped, count, _) = preRoll.Dequeue();
+                        ArrayPool<float>.Shared.Return(dropped);
+                        preRollSamples -= count;
+                        droppedDuration += count / channelCount * 1_000_000_000L / sampleRate;
+                    }
+                    return;
+                }
+                // Forward pre-roll
+                while (preRoll.Count > 0) {
+                    var (samples, count, preRollTimestamp) = preRoll.Dequeue();
+                    fixed (float* samplesData = samples)
+                        using (var preRollBuffer = new AudioBuffer(sampleRate, channelCount, samplesData, count, Offset(preRollTimestamp)))
+                            handler(preRollBuffer);
+                    ArrayPool<float>.Shared.Return(samples);
+                }
+                preRollSamples = 0;
+                // Forward speech
+                if (droppedDuration == 0L || timestamp == 0L)
+                    handler(audioBuffer);
+                else
+                    using (var speechBuffer = new AudioBuffer(sampleRate, channelCount, (float*)data.GetUnsafeReadOnlyPtr(), data.Length, Offset(timestamp)))
+                        handler(speechBuffer);
+            }
+
+            private readonly VoiceActivityDetector detector;
+            private readonly Action<AudioBuffer> handler;
+            private readonly int maxPreRollSamples;
+            private readonly Queue<(float[] samples, int count, long timestamp)> preRoll;
+            private int preRollSamples;
+            private long droppedDuration;
+
+            private long Offset(long timestamp) => timestamp != 0L ? timestamp - droppedDuration : 0L;
+        }
+
+        private bool ProcessFrame() {
+            // Compute energy and zero crossings
+            var vectorSize = Vector<float>.Count;
+            var energy = Vector<float>.Zero;
+            var crossings = Vector<int>.Zero;
+            var i = 0;
+            for (; i + vectorSize < frameSize; i += vectorSize) {
+                var current = new Vector<float>(frame, i);
+                var next = new Vector<float>(frame, i + 1);
+                energy += current * current;
+                crossings -= Vector.LessThan(current * next, Vector<float>.Zero); // `LessThan` is -1 where true
+            }
+            var power = Vector.Dot(energy, Vector<float>.One);
+            var crossingCount = Vector.Dot(crossings, Vector<int>.One);
+            for (; i < frameSize; ++i) {
+                power += frame[i] * frame[i];
+                if (i + 1 < frameSize && frame[i] * frame[i + 1] < 0f)
+                    ++crossingCount;
+            }
+            var level = 10f * MathF.Log10(power / frameSize + 1e-12f);
+            var zeroCrossingRate = (float)crossingCount / frameSize;
+            // Track noise floor, falling quickly and rising slowly
+            if (float.IsNaN(noiseLevel))
+                noiseLevel = level;
+            else
+                noiseLevel += (level - noiseLevel) * (level < noiseLevel ? 0.5f : 0.002f);
+            // Classify, requiring noisy frames like hiss and wind to be louder before they count as speech
+            var margin = level - Math.Max(noiseLevel, minimumLevel - threshold);
+            return zeroCrossingRate < 0.25f ? margin > threshold : margin > 2f * threshold;
+        }
+        #endregion
+    }
+}
\ No newline at end of file